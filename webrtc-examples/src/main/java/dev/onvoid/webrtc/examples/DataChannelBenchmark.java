@@ -0,0 +1,490 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.examples;
+
+import java.lang.management.ManagementFactory;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+
+import com.sun.management.OperatingSystemMXBean;
+
+import dev.onvoid.webrtc.CreateSessionDescriptionObserver;
+import dev.onvoid.webrtc.PeerConnectionFactory;
+import dev.onvoid.webrtc.PeerConnectionObserver;
+import dev.onvoid.webrtc.RTCAnswerOptions;
+import dev.onvoid.webrtc.RTCConfiguration;
+import dev.onvoid.webrtc.RTCDataChannel;
+import dev.onvoid.webrtc.RTCDataChannelBuffer;
+import dev.onvoid.webrtc.RTCDataChannelInit;
+import dev.onvoid.webrtc.RTCDataChannelObserver;
+import dev.onvoid.webrtc.RTCDataChannelState;
+import dev.onvoid.webrtc.RTCIceCandidate;
+import dev.onvoid.webrtc.RTCOfferOptions;
+import dev.onvoid.webrtc.RTCPeerConnection;
+import dev.onvoid.webrtc.RTCPeerConnectionState;
+import dev.onvoid.webrtc.RTCSessionDescription;
+import dev.onvoid.webrtc.SetSessionDescriptionObserver;
+import dev.onvoid.webrtc.media.audio.AudioDeviceModule;
+import dev.onvoid.webrtc.media.audio.AudioLayer;
+
+/**
+ * Benchmark measuring data channel throughput and latency through the Java
+ * bindings without a network or signaling server.
+ * <p>
+ * Two peer connections are created in the same process and connected by
+ * exchanging the session descriptions and ICE candidates directly. For each
+ * combination of message size, ordering, reliability and send path
+ * ({@code send} or {@code sendAsync}) a negotiated data channel pair is
+ * opened and saturated for a fixed duration. The benchmark reports:
+ * <ul>
+ *   <li>messages and megabytes per second received</li>
+ *   <li>p50 and p99 one-way latency, measured with a send timestamp carried
+ *   in the first eight bytes of each message</li>
+ *   <li>process CPU time per received message</li>
+ * </ul>
+ * The results can be compared with those of the native
+ * {@code webrtc-java-benchmark} target, which runs the same sweep without
+ * the JNI layer, to make binding overhead visible.
+ * <p>
+ * The optional first argument sets the duration of each run in milliseconds.
+ */
+public class DataChannelBenchmark {
+
+    private static final int[] MESSAGE_SIZES = { 16, 256, 1024, 16 * 1024, 64 * 1024 };
+
+    /** Sending pauses once this many bytes are queued in the data channel. */
+    private static final long HIGH_WATERMARK = 1024 * 1024;
+
+    /** Sending resumes once the queued bytes drop below this amount. */
+    private static final long LOW_WATERMARK = 256 * 1024;
+
+    /** Upper bound of latency samples kept per run. */
+    private static final int MAX_SAMPLES = 1 << 20;
+
+    private static final int DEFAULT_DURATION_MS = 2000;
+
+
+    public static void main(String[] args) throws Exception {
+        int duration = args.length > 0 ? Integer.parseInt(args[0]) : DEFAULT_DURATION_MS;
+
+        AudioDeviceModule audioModule = new AudioDeviceModule(AudioLayer.kDummyAudio);
+        PeerConnectionFactory factory = new PeerConnectionFactory(audioModule);
+
+        LoopbackConnection connection = new LoopbackConnection(factory);
+
+        try {
+            connection.connect();
+
+            System.out.printf("%8s %10s %12s %6s | %10s %9s %10s %10s %12s%n",
+                    "size", "ordered", "reliability", "send",
+                    "msg/s", "MB/s", "p50 (us)", "p99 (us)", "cpu/msg (us)");
+
+            int channelId = 1;
+
+            for (int size : MESSAGE_SIZES) {
+                for (boolean ordered : new boolean[] { true, false }) {
+                    for (boolean reliable : new boolean[] { true, false }) {
+                        for (boolean async : new boolean[] { false, true }) {
+                            RunConfig config = new RunConfig(size, ordered, reliable, async);
+                            RunResult result = connection.run(config, channelId++, duration);
+
+                            System.out.printf("%8d %10s %12s %6s | %10.0f %9.2f %10.1f %10.1f %12.2f%n",
+                                    size, ordered, reliable ? "reliable" : "partial",
+                                    async ? "async" : "sync",
+                                    result.messagesPerSecond(), result.megabytesPerSecond(),
+                                    result.latencyPercentile(0.5) / 1000.0,
+                                    result.latencyPercentile(0.99) / 1000.0,
+                                    result.cpuNanosPerMessage() / 1000.0);
+                        }
+                    }
+                }
+            }
+        }
+        finally {
+            connection.close();
+            factory.dispose();
+            audioModule.dispose();
+        }
+    }
+
+    private static RTCDataChannelInit negotiatedInit(int id) {
+        RTCDataChannelInit init = new RTCDataChannelInit();
+        init.negotiated = true;
+        init.id = id;
+
+        return init;
+    }
+
+    private static long getProcessCpuTime() {
+        OperatingSystemMXBean bean = (OperatingSystemMXBean) ManagementFactory.getOperatingSystemMXBean();
+
+        return bean.getProcessCpuTime();
+    }
+
+    private record RunConfig(int size, boolean ordered, boolean reliable, boolean async) {
+
+        RTCDataChannelInit createInit(int id) {
+            RTCDataChannelInit init = negotiatedInit(id);
+            init.ordered = ordered;
+
+            if (!reliable) {
+                init.maxRetransmits = 0;
+            }
+
+            return init;
+        }
+    }
+
+    private record RunResult(long messages, long bytes, long elapsedNanos, long cpuNanos, long[] latencies) {
+
+        double messagesPerSecond() {
+            return elapsedNanos > 0 ? messages * 1e9 / elapsedNanos : 0;
+        }
+
+        double megabytesPerSecond() {
+            return elapsedNanos > 0 ? bytes * 1e9 / elapsedNanos / (1024 * 1024) : 0;
+        }
+
+        double cpuNanosPerMessage() {
+            return messages > 0 ? (double) cpuNanos / messages : 0;
+        }
+
+        long latencyPercentile(double percentile) {
+            if (latencies.length == 0) {
+                return 0;
+            }
+
+            int index = (int) Math.ceil(percentile * latencies.length) - 1;
+
+            return latencies[Math.max(0, Math.min(index, latencies.length - 1))];
+        }
+    }
+
+    /**
+     * Receives benchmark messages and records the one-way latency of each.
+     * All callbacks run on the native network thread; the counters are read
+     * by the benchmark thread once a run has drained.
+     */
+    private static class Receiver implements RTCDataChannelObserver {
+
+        private final CountDownLatch openLatch = new CountDownLatch(1);
+
+        private final long[] samples = new long[MAX_SAMPLES];
+
+        private final RTCDataChannel channel;
+
+        private int sampleCount;
+
+        private long bytes;
+
+        private volatile long lastReceiveTime;
+
+        private volatile long messages;
+
+
+        Receiver(RTCDataChannel channel) {
+            this.channel = channel;
+        }
+
+        @Override
+        public void onBufferedAmountChange(long previousAmount) {
+
+        }
+
+        @Override
+        public void onStateChange() {
+            if (channel.getState() == RTCDataChannelState.OPEN) {
+                openLatch.countDown();
+            }
+        }
+
+        @Override
+        public void onMessage(RTCDataChannelBuffer buffer) {
+            long now = System.nanoTime();
+            ByteBuffer data = buffer.data;
+
+            if (sampleCount < samples.length) {
+                samples[sampleCount++] = now - data.getLong(data.position());
+            }
+
+            bytes += data.remaining();
+            lastReceiveTime = now;
+            messages++;
+        }
+    }
+
+    /**
+     * Sends benchmark messages and pauses whenever the data channel has
+     * queued more than {@link #HIGH_WATERMARK} bytes.
+     */
+    private static class Sender implements RTCDataChannelObserver {
+
+        private final CountDownLatch openLatch = new CountDownLatch(1);
+
+        private final Object lock = new Object();
+
+        private final RTCDataChannel channel;
+
+
+        Sender(RTCDataChannel channel) {
+            this.channel = channel;
+        }
+
+        @Override
+        public void onBufferedAmountChange(long previousAmount) {
+            if (channel.getBufferedAmount() < LOW_WATERMARK) {
+                synchronized (lock) {
+                    lock.notifyAll();
+                }
+            }
+        }
+
+        @Override
+        public void onStateChange() {
+            if (channel.getState() == RTCDataChannelState.OPEN) {
+                openLatch.countDown();
+            }
+        }
+
+        @Override
+        public void onMessage(RTCDataChannelBuffer buffer) {
+
+        }
+
+        long send(RunConfig config, long duration) throws Exception {
+            ByteBuffer data = ByteBuffer.allocateDirect(config.size());
+            RTCDataChannelBuffer buffer = new RTCDataChannelBuffer(data, true);
+
+            long sent = 0;
+            long end = System.nanoTime() + duration;
+
+            while (System.nanoTime() < end) {
+                if (channel.getBufferedAmount() > HIGH_WATERMARK) {
+                    synchronized (lock) {
+                        while (channel.getBufferedAmount() > LOW_WATERMARK && System.nanoTime() < end) {
+                            lock.wait(1);
+                        }
+                    }
+                    continue;
+                }
+
+                data.putLong(0, System.nanoTime());
+
+                if (config.async()) {
+                    channel.sendAsync(buffer);
+                }
+                else {
+                    channel.send(buffer);
+                }
+
+                sent++;
+            }
+
+            return sent;
+        }
+    }
+
+    /**
+     * Two peer connections living in the same process, connected by passing
+     * descriptions and candidates directly to each other.
+     */
+    private static class LoopbackConnection {
+
+        private final CountDownLatch connectedLatch = new CountDownLatch(2);
+
+        private final RTCPeerConnection offerer;
+
+        private final RTCPeerConnection answerer;
+
+        private final RTCDataChannel offererControl;
+
+        private final RTCDataChannel answererControl;
+
+
+        LoopbackConnection(PeerConnectionFactory factory) {
+            RTCConfiguration config = new RTCConfiguration();
+
+            PeerObserver offererObserver = new PeerObserver();
+            PeerObserver answererObserver = new PeerObserver();
+
+            offerer = factory.createPeerConnection(config, offererObserver);
+            answerer = factory.createPeerConnection(config, answererObserver);
+
+            offererObserver.remote = answerer;
+            answererObserver.remote = offerer;
+
+            // A negotiated channel puts the SCTP transport into the offer.
+            // Benchmark channels are negotiated as well, so they can be
+            // opened later without another offer/answer exchange.
+            offererControl = offerer.createDataChannel("control", negotiatedInit(0));
+            answererControl = answerer.createDataChannel("control", negotiatedInit(0));
+        }
+
+        void connect() throws Exception {
+            RTCSessionDescription offer = createDescription(offerer, true);
+            setDescription(offerer, offer, true);
+            setDescription(answerer, offer, false);
+
+            RTCSessionDescription answer = createDescription(answerer, false);
+            setDescription(answerer, answer, true);
+            setDescription(offerer, answer, false);
+
+            if (!connectedLatch.await(10, TimeUnit.SECONDS)) {
+                throw new IllegalStateException("Loopback connection timed out");
+            }
+        }
+
+        RunResult run(RunConfig config, int channelId, long durationMs) throws Exception {
+            String label = "bench-" + channelId;
+
+            RTCDataChannel sendChannel = offerer.createDataChannel(label, config.createInit(channelId));
+            RTCDataChannel receiveChannel = answerer.createDataChannel(label, config.createInit(channelId));
+
+            Sender sender = new Sender(sendChannel);
+            Receiver receiver = new Receiver(receiveChannel);
+
+            sendChannel.registerObserver(sender);
+            receiveChannel.registerObserver(receiver);
+
+            try {
+                awaitOpen(sender.openLatch, sendChannel);
+                awaitOpen(receiver.openLatch, receiveChannel);
+
+                long cpuStart = getProcessCpuTime();
+                long start = System.nanoTime();
+
+                long sent = sender.send(config, TimeUnit.MILLISECONDS.toNanos(durationMs));
+                long sendEnd = System.nanoTime();
+
+                // Wait until everything has arrived, or until nothing has
+                // arrived for a while, which partial reliability may cause.
+                long idleLimit = TimeUnit.MILLISECONDS.toNanos(500);
+
+                while (receiver.messages < sent
+                        && System.nanoTime() - Math.max(receiver.lastReceiveTime, sendEnd) < idleLimit) {
+                    Thread.sleep(1);
+                }
+
+                long cpuNanos = getProcessCpuTime() - cpuStart;
+                long elapsed = Math.max(receiver.lastReceiveTime - start, 0);
+                long messages = receiver.messages;
+
+                long[] latencies = Arrays.copyOf(receiver.samples, receiver.sampleCount);
+                Arrays.sort(latencies);
+
+                return new RunResult(messages, receiver.bytes, elapsed, cpuNanos, latencies);
+            }
+            finally {
+                sendChannel.unregisterObserver();
+                receiveChannel.unregisterObserver();
+                sendChannel.close();
+                receiveChannel.close();
+                sendChannel.dispose();
+                receiveChannel.dispose();
+            }
+        }
+
+        void close() {
+            offererControl.close();
+            answererControl.close();
+            offererControl.dispose();
+            answererControl.dispose();
+            offerer.close();
+            answerer.close();
+        }
+
+        private static void awaitOpen(CountDownLatch latch, RTCDataChannel channel) throws InterruptedException {
+            if (channel.getState() != RTCDataChannelState.OPEN && !latch.await(5, TimeUnit.SECONDS)) {
+                throw new IllegalStateException("Data channel " + channel.getLabel() + " did not open");
+            }
+        }
+
+        private static RTCSessionDescription createDescription(RTCPeerConnection pc, boolean offer) throws Exception {
+            CompletableFuture<RTCSessionDescription> future = new CompletableFuture<>();
+
+            CreateSessionDescriptionObserver observer = new CreateSessionDescriptionObserver() {
+
+                @Override
+                public void onSuccess(RTCSessionDescription description) {
+                    future.complete(description);
+                }
+
+                @Override
+                public void onFailure(String error) {
+                    future.completeExceptionally(new IllegalStateException(error));
+                }
+            };
+
+            if (offer) {
+                pc.createOffer(new RTCOfferOptions(), observer);
+            }
+            else {
+                pc.createAnswer(new RTCAnswerOptions(), observer);
+            }
+
+            return future.get(5, TimeUnit.SECONDS);
+        }
+
+        private static void setDescription(RTCPeerConnection pc, RTCSessionDescription description, boolean local)
+                throws Exception {
+            CompletableFuture<Void> future = new CompletableFuture<>();
+
+            SetSessionDescriptionObserver observer = new SetSessionDescriptionObserver() {
+
+                @Override
+                public void onSuccess() {
+                    future.complete(null);
+                }
+
+                @Override
+                public void onFailure(String error) {
+                    future.completeExceptionally(new IllegalStateException(error));
+                }
+            };
+
+            if (local) {
+                pc.setLocalDescription(description, observer);
+            }
+            else {
+                pc.setRemoteDescription(description, observer);
+            }
+
+            future.get(5, TimeUnit.SECONDS);
+        }
+
+        private class PeerObserver implements PeerConnectionObserver {
+
+            private RTCPeerConnection remote;
+
+
+            @Override
+            public void onIceCandidate(RTCIceCandidate candidate) {
+                remote.addIceCandidate(candidate);
+            }
+
+            @Override
+            public void onConnectionChange(RTCPeerConnectionState state) {
+                if (state == RTCPeerConnectionState.CONNECTED) {
+                    connectedLatch.countDown();
+                }
+            }
+        }
+    }
+}
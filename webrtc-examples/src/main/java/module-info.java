@@ -2,7 +2,9 @@ module webrtc.java.examples {
 
     requires com.fasterxml.jackson.databind;
     requires java.logging;
+    requires java.management;
     requires java.net.http;
+    requires jdk.management;
     requires org.eclipse.jetty.server;
     requires org.eclipse.jetty.websocket.server;
     requires webrtc.java;
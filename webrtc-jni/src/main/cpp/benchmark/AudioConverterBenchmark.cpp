@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the single pipeline of jni::AudioConverter with the previous
+// chain of webrtc::ChannelMixer and webrtc::PushResampler, which copied every
+// frame through a webrtc::AudioFrame and an intermediate buffer.
+//
+// Usage: webrtc-java-audio-benchmark [iterations]
+
+#include "media/audio/AudioConverter.h"
+
+#include "api/audio/audio_frame.h"
+#include "audio/utility/channel_mixer.h"
+#include "common_audio/resampler/include/push_resampler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	struct ConversionCase
+	{
+		int srcRate;
+		size_t srcChannels;
+		int dstRate;
+		size_t dstChannels;
+	};
+
+	constexpr ConversionCase kCases[] = {
+		{ 44100, 2, 48000, 1 },
+		{ 48000, 1, 16000, 1 },
+		{ 48000, 2, 16000, 1 },
+		{ 48000, 2, 48000, 1 },
+		{ 16000, 1, 48000, 2 },
+		{ 48000, 2, 44100, 2 },
+	};
+
+	constexpr int kDefaultIterations = 20000;
+
+	int64_t NowNanos()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// The conversion chain jni::AudioConverter used before: mix and resample
+	// in separate stages, each with its own copy of the frame.
+	class LegacyConverter
+	{
+		public:
+			LegacyConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels) :
+				srcFrames(srcFrames),
+				srcChannels(srcChannels),
+				dstFrames(dstFrames),
+				dstChannels(dstChannels),
+				mixFirst(srcChannels > dstChannels)
+			{
+				if (srcChannels != dstChannels) {
+					mixer = std::make_unique<webrtc::ChannelMixer>(
+						webrtc::GuessChannelLayout(static_cast<int>(srcChannels)),
+						webrtc::GuessChannelLayout(static_cast<int>(dstChannels)));
+				}
+				if (srcFrames != dstFrames) {
+					const size_t channels = mixFirst ? dstChannels : srcChannels;
+
+					resampler = std::make_unique<webrtc::PushResampler<int16_t>>(srcFrames, dstFrames, channels);
+				}
+
+				intermediate.resize(std::max(srcFrames, dstFrames) * std::max(srcChannels, dstChannels));
+			}
+
+			void convert(const int16_t * src, int16_t * dst)
+			{
+				if (mixer && resampler) {
+					if (mixFirst) {
+						mix(src, srcFrames, srcChannels, intermediate.data());
+						resample(intermediate.data(), dstChannels, dst);
+					}
+					else {
+						resample(src, srcChannels, intermediate.data());
+						mix(intermediate.data(), dstFrames, srcChannels, dst);
+					}
+				}
+				else if (mixer) {
+					mix(src, srcFrames, srcChannels, dst);
+				}
+				else if (resampler) {
+					resample(src, srcChannels, dst);
+				}
+				else {
+					std::memcpy(dst, src, srcFrames * srcChannels * sizeof(int16_t));
+				}
+			}
+
+		private:
+			void mix(const int16_t * src, size_t frames, size_t channels, int16_t * dst)
+			{
+				frame.samples_per_channel_ = frames;
+				frame.num_channels_ = channels;
+
+				std::memcpy(frame.mutable_data(), src, frames * channels * sizeof(int16_t));
+
+				mixer->Transform(&frame);
+
+				std::memcpy(dst, frame.data(), frames * dstChannels * sizeof(int16_t));
+			}
+
+			void resample(const int16_t * src, size_t channels, int16_t * dst)
+			{
+				webrtc::InterleavedView<const int16_t> srcView(src, srcFrames, channels);
+				webrtc::InterleavedView<int16_t> dstView(dst, dstFrames, channels);
+
+				resampler->Resample(srcView, dstView);
+			}
+
+		private:
+			const size_t srcFrames;
+			const size_t srcChannels;
+			const size_t dstFrames;
+			const size_t dstChannels;
+			const bool mixFirst;
+
+			std::unique_ptr<webrtc::ChannelMixer> mixer;
+			std::unique_ptr<webrtc::PushResampler<int16_t>> resampler;
+			webrtc::AudioFrame frame;
+			std::vector<int16_t> intermediate;
+	};
+
+	template <typename T>
+	void FillSine(std::vector<T> & samples, size_t channels, int sampleRate, float scale)
+	{
+		const size_t frames = samples.size() / channels;
+
+		for (size_t i = 0; i < frames; i++) {
+			const float value = scale * 0.5f * std::sin(2.0f * 3.14159265f * 440.0f * i / sampleRate);
+
+			for (size_t c = 0; c < channels; c++) {
+				samples[i * channels + c] = static_cast<T>(value);
+			}
+		}
+	}
+
+	template <typename Function>
+	double NanosPerFrame(int iterations, Function && convert)
+	{
+		// Warm up the filter state and the caches.
+		for (int i = 0; i < iterations / 10; i++) {
+			convert();
+		}
+
+		const int64_t start = NowNanos();
+
+		for (int i = 0; i < iterations; i++) {
+			convert();
+		}
+
+		return static_cast<double>(NowNanos() - start) / iterations;
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	const int iterations = argc > 1 ? std::atoi(argv[1]) : kDefaultIterations;
+
+	std::printf("%22s | %12s %12s %12s | %8s\n",
+		"conversion", "legacy (ns)", "int16 (ns)", "float (ns)", "speedup");
+
+	for (const ConversionCase & c : kCases) {
+		const size_t srcFrames = static_cast<size_t>(c.srcRate / 100);
+		const size_t dstFrames = static_cast<size_t>(c.dstRate / 100);
+
+		std::vector<int16_t> src16(srcFrames * c.srcChannels);
+		std::vector<int16_t> dst16(dstFrames * c.dstChannels);
+		std::vector<float> srcFloat(srcFrames * c.srcChannels);
+		std::vector<float> dstFloat(dstFrames * c.dstChannels);
+
+		FillSine(src16, c.srcChannels, c.srcRate, 32767.0f);
+		FillSine(srcFloat, c.srcChannels, c.srcRate, 1.0f);
+
+		LegacyConverter legacy(srcFrames, c.srcChannels, dstFrames, c.dstChannels);
+		auto converter16 = jni::AudioConverter::create(srcFrames, c.srcChannels, dstFrames, c.dstChannels);
+		auto converterFloat = jni::AudioConverter::create(srcFrames, c.srcChannels, dstFrames, c.dstChannels);
+
+		const double legacyNanos = NanosPerFrame(iterations, [&] {
+			legacy.convert(src16.data(), dst16.data());
+		});
+		const double int16Nanos = NanosPerFrame(iterations, [&] {
+			converter16->convert(src16.data(), src16.size(), dst16.data(), dst16.size());
+		});
+		const double floatNanos = NanosPerFrame(iterations, [&] {
+			converterFloat->convert(srcFloat.data(), srcFloat.size(), dstFloat.data(), dstFloat.size());
+		});
+
+		char name[32];
+		std::snprintf(name, sizeof(name), "%d/%zu -> %d/%zu", c.srcRate, c.srcChannels, c.dstRate, c.dstChannels);
+
+		std::printf("%22s | %12.0f %12.0f %12.0f | %7.2fx\n",
+			name, legacyNanos, int16Nanos, floatNanos, legacyNanos / int16Nanos);
+	}
+
+	return 0;
+}
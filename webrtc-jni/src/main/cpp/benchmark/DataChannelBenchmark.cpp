@@ -0,0 +1,581 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Native counterpart of dev.onvoid.webrtc.examples.DataChannelBenchmark.
+//
+// Connects two peer connections in one process and runs the same sweep over
+// message size, ordering, reliability and send path as the Java runner, but
+// without the JNI layer. Comparing both result tables shows the overhead
+// added by the bindings.
+//
+// Usage: webrtc-java-benchmark [duration-ms]
+
+#include "api/audio/create_audio_device_module.h"
+#include "api/audio_codecs/builtin_audio_decoder_factory.h"
+#include "api/audio_codecs/builtin_audio_encoder_factory.h"
+#include "api/create_peerconnection_factory.h"
+#include "api/data_channel_interface.h"
+#include "api/environment/environment_factory.h"
+#include "api/jsep.h"
+#include "api/make_ref_counted.h"
+#include "api/peer_connection_interface.h"
+#include "api/scoped_refptr.h"
+#include "api/units/time_delta.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/event.h"
+#include "rtc_base/ssl_adapter.h"
+#include "rtc_base/thread.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr size_t kMessageSizes[] = { 16, 256, 1024, 16 * 1024, 64 * 1024 };
+
+	// Sending pauses above the high and resumes below the low watermark.
+	constexpr uint64_t kHighWatermark = 1024 * 1024;
+	constexpr uint64_t kLowWatermark = 256 * 1024;
+
+	// Upper bound of latency samples kept per run.
+	constexpr size_t kMaxSamples = 1 << 20;
+
+	constexpr int kDefaultDurationMs = 2000;
+
+	int64_t NowNanos()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	int64_t ProcessCpuTimeNanos()
+	{
+#ifdef _WIN32
+		FILETIME creation, exit, kernel, user;
+
+		if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+			return 0;
+		}
+
+		ULARGE_INTEGER k, u;
+		k.LowPart = kernel.dwLowDateTime;
+		k.HighPart = kernel.dwHighDateTime;
+		u.LowPart = user.dwLowDateTime;
+		u.HighPart = user.dwHighDateTime;
+
+		// FILETIME counts in 100 ns intervals.
+		return static_cast<int64_t>((k.QuadPart + u.QuadPart) * 100);
+#else
+		struct rusage usage;
+
+		if (getrusage(RUSAGE_SELF, &usage) != 0) {
+			return 0;
+		}
+
+		int64_t seconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec;
+		int64_t micros = usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+
+		return seconds * 1000000000LL + micros * 1000LL;
+#endif
+	}
+
+	struct RunConfig
+	{
+		size_t size;
+		bool ordered;
+		bool reliable;
+		bool async;
+	};
+
+	struct RunResult
+	{
+		uint64_t messages = 0;
+		uint64_t bytes = 0;
+		int64_t elapsedNanos = 0;
+		int64_t cpuNanos = 0;
+		std::vector<int64_t> latencies;
+
+		double messagesPerSecond() const
+		{
+			return elapsedNanos > 0 ? messages * 1e9 / elapsedNanos : 0;
+		}
+
+		double megabytesPerSecond() const
+		{
+			return elapsedNanos > 0 ? bytes * 1e9 / elapsedNanos / (1024 * 1024) : 0;
+		}
+
+		double cpuNanosPerMessage() const
+		{
+			return messages > 0 ? static_cast<double>(cpuNanos) / messages : 0;
+		}
+
+		int64_t latencyPercentile(double percentile) const
+		{
+			if (latencies.empty()) {
+				return 0;
+			}
+
+			int64_t index = static_cast<int64_t>(std::ceil(percentile * latencies.size())) - 1;
+			index = std::clamp<int64_t>(index, 0, static_cast<int64_t>(latencies.size()) - 1);
+
+			return latencies[index];
+		}
+	};
+
+	webrtc::DataChannelInit CreateInit(int id, const RunConfig & config)
+	{
+		webrtc::DataChannelInit init;
+		init.negotiated = true;
+		init.id = id;
+		init.ordered = config.ordered;
+
+		if (!config.reliable) {
+			init.maxRetransmits = 0;
+		}
+
+		return init;
+	}
+
+	class ChannelObserver : public webrtc::DataChannelObserver
+	{
+		public:
+			explicit ChannelObserver(webrtc::DataChannelInterface * channel) :
+				channel(channel),
+				messages(0),
+				bytes(0),
+				lastReceiveTime(0)
+			{
+				samples.reserve(kMaxSamples);
+			}
+
+			void OnStateChange() override
+			{
+				if (channel->state() == webrtc::DataChannelInterface::kOpen) {
+					opened.Set();
+				}
+			}
+
+			// Runs on the network thread. Only the receiving side gets here.
+			void OnMessage(const webrtc::DataBuffer & buffer) override
+			{
+				int64_t now = NowNanos();
+				int64_t sendTime;
+
+				std::memcpy(&sendTime, buffer.data.cdata(), sizeof(sendTime));
+
+				if (samples.size() < kMaxSamples) {
+					samples.push_back(now - sendTime);
+				}
+
+				bytes.fetch_add(buffer.data.size(), std::memory_order_relaxed);
+				lastReceiveTime.store(now, std::memory_order_relaxed);
+				messages.fetch_add(1, std::memory_order_release);
+			}
+
+			void OnBufferedAmountChange(uint64_t sent_data_size) override
+			{
+				if (channel->buffered_amount() < kLowWatermark) {
+					drained.Set();
+				}
+			}
+
+			bool waitOpen()
+			{
+				return channel->state() == webrtc::DataChannelInterface::kOpen ||
+					opened.Wait(webrtc::TimeDelta::Seconds(5));
+			}
+
+			webrtc::DataChannelInterface * channel;
+
+			webrtc::Event opened;
+			webrtc::Event drained;
+
+			std::vector<int64_t> samples;
+			std::atomic<uint64_t> messages;
+			std::atomic<uint64_t> bytes;
+			std::atomic<int64_t> lastReceiveTime;
+	};
+
+	class CreateDescObserver : public webrtc::CreateSessionDescriptionObserver
+	{
+		public:
+			void OnSuccess(webrtc::SessionDescriptionInterface * desc) override
+			{
+				desc->ToString(&sdp);
+				type = desc->GetType();
+				delete desc;
+				done.Set();
+			}
+
+			void OnFailure(webrtc::RTCError error) override
+			{
+				this->error = error.message();
+				done.Set();
+			}
+
+			webrtc::Event done;
+			webrtc::SdpType type = webrtc::SdpType::kOffer;
+			std::string sdp;
+			std::string error;
+	};
+
+	class SetDescObserver : public webrtc::SetSessionDescriptionObserver
+	{
+		public:
+			void OnSuccess() override
+			{
+				done.Set();
+			}
+
+			void OnFailure(webrtc::RTCError error) override
+			{
+				this->error = error.message();
+				done.Set();
+			}
+
+			webrtc::Event done;
+			std::string error;
+	};
+
+	class LoopbackConnection
+	{
+		public:
+			explicit LoopbackConnection(webrtc::PeerConnectionFactoryInterface * factory) :
+				offererObserver(this),
+				answererObserver(this),
+				connectedCount(0)
+			{
+				webrtc::PeerConnectionInterface::RTCConfiguration config;
+				config.sdp_semantics = webrtc::SdpSemantics::kUnifiedPlan;
+
+				offerer = create(factory, config, &offererObserver);
+				answerer = create(factory, config, &answererObserver);
+
+				offererObserver.remote = answerer.get();
+				answererObserver.remote = offerer.get();
+
+				// A negotiated channel puts the SCTP transport into the offer.
+				// Benchmark channels are negotiated as well, so they can be
+				// opened later without another offer/answer exchange.
+				RunConfig control = { 0, true, true, false };
+				webrtc::DataChannelInit init = CreateInit(0, control);
+
+				offererControl = offerer->CreateDataChannelOrError("control", &init).MoveValue();
+				answererControl = answerer->CreateDataChannelOrError("control", &init).MoveValue();
+			}
+
+			~LoopbackConnection()
+			{
+				offererControl->Close();
+				answererControl->Close();
+				offerer->Close();
+				answerer->Close();
+			}
+
+			bool connect()
+			{
+				std::string sdp;
+				webrtc::SdpType type;
+
+				if (!createDescription(offerer.get(), true, &type, &sdp) ||
+					!setDescription(offerer.get(), type, sdp, true) ||
+					!setDescription(answerer.get(), type, sdp, false)) {
+					return false;
+				}
+				if (!createDescription(answerer.get(), false, &type, &sdp) ||
+					!setDescription(answerer.get(), type, sdp, true) ||
+					!setDescription(offerer.get(), type, sdp, false)) {
+					return false;
+				}
+
+				return connected.Wait(webrtc::TimeDelta::Seconds(10));
+			}
+
+			RunResult run(const RunConfig & config, int channelId, int durationMs)
+			{
+				RunResult result;
+
+				std::string label = "bench-" + std::to_string(channelId);
+				webrtc::DataChannelInit init = CreateInit(channelId, config);
+
+				auto sendChannel = offerer->CreateDataChannelOrError(label, &init).MoveValue();
+				auto receiveChannel = answerer->CreateDataChannelOrError(label, &init).MoveValue();
+
+				ChannelObserver sender(sendChannel.get());
+				ChannelObserver receiver(receiveChannel.get());
+
+				sendChannel->RegisterObserver(&sender);
+				receiveChannel->RegisterObserver(&receiver);
+
+				if (sender.waitOpen() && receiver.waitOpen()) {
+					int64_t cpuStart = ProcessCpuTimeNanos();
+					int64_t start = NowNanos();
+					int64_t end = start + durationMs * 1000000LL;
+					uint64_t sent = 0;
+
+					while (NowNanos() < end) {
+						if (sendChannel->buffered_amount() > kHighWatermark) {
+							sender.drained.Wait(webrtc::TimeDelta::Millis(1));
+							continue;
+						}
+
+						webrtc::CopyOnWriteBuffer payload(config.size);
+						int64_t sendTime = NowNanos();
+
+						std::memcpy(payload.MutableData(), &sendTime, sizeof(sendTime));
+
+						webrtc::DataBuffer buffer(payload, true);
+
+						if (config.async) {
+							sendChannel->SendAsync(buffer, [](webrtc::RTCError) {});
+						}
+						else {
+							sendChannel->Send(buffer);
+						}
+
+						sent++;
+					}
+
+					int64_t sendEnd = NowNanos();
+					const int64_t idleLimit = 500 * 1000000LL;
+
+					// Wait until everything has arrived, or until nothing has
+					// arrived for a while, which partial reliability may cause.
+					while (receiver.messages.load(std::memory_order_acquire) < sent &&
+						NowNanos() - std::max(receiver.lastReceiveTime.load(), sendEnd) < idleLimit) {
+						webrtc::Thread::SleepMs(1);
+					}
+
+					result.cpuNanos = ProcessCpuTimeNanos() - cpuStart;
+					result.elapsedNanos = std::max<int64_t>(receiver.lastReceiveTime.load() - start, 0);
+				}
+
+				sendChannel->UnregisterObserver();
+				receiveChannel->UnregisterObserver();
+				sendChannel->Close();
+				receiveChannel->Close();
+
+				result.messages = receiver.messages.load(std::memory_order_acquire);
+				result.bytes = receiver.bytes.load();
+				result.latencies = std::move(receiver.samples);
+
+				std::sort(result.latencies.begin(), result.latencies.end());
+
+				return result;
+			}
+
+		private:
+			class PeerObserver : public webrtc::PeerConnectionObserver
+			{
+				public:
+					explicit PeerObserver(LoopbackConnection * connection) :
+						connection(connection),
+						remote(nullptr)
+					{
+					}
+
+					void OnSignalingChange(webrtc::PeerConnectionInterface::SignalingState state) override {}
+					void OnDataChannel(webrtc::scoped_refptr<webrtc::DataChannelInterface> channel) override {}
+					void OnIceGatheringChange(webrtc::PeerConnectionInterface::IceGatheringState state) override {}
+
+					void OnIceCandidate(const webrtc::IceCandidateInterface * candidate) override
+					{
+						remote->AddIceCandidate(candidate);
+					}
+
+					void OnConnectionChange(webrtc::PeerConnectionInterface::PeerConnectionState state) override
+					{
+						if (state == webrtc::PeerConnectionInterface::PeerConnectionState::kConnected &&
+							connection->connectedCount.fetch_add(1) == 1) {
+							connection->connected.Set();
+						}
+					}
+
+					LoopbackConnection * connection;
+					webrtc::PeerConnectionInterface * remote;
+			};
+
+			static webrtc::scoped_refptr<webrtc::PeerConnectionInterface> create(
+				webrtc::PeerConnectionFactoryInterface * factory,
+				const webrtc::PeerConnectionInterface::RTCConfiguration & config,
+				PeerObserver * observer)
+			{
+				webrtc::PeerConnectionDependencies dependencies(observer);
+
+				return factory->CreatePeerConnectionOrError(config, std::move(dependencies)).MoveValue();
+			}
+
+			static bool createDescription(webrtc::PeerConnectionInterface * pc, bool offer,
+				webrtc::SdpType * type, std::string * sdp)
+			{
+				auto observer = webrtc::make_ref_counted<CreateDescObserver>();
+				webrtc::PeerConnectionInterface::RTCOfferAnswerOptions options;
+
+				if (offer) {
+					pc->CreateOffer(observer.get(), options);
+				}
+				else {
+					pc->CreateAnswer(observer.get(), options);
+				}
+
+				if (!observer->done.Wait(webrtc::TimeDelta::Seconds(5)) || !observer->error.empty()) {
+					std::fprintf(stderr, "Create description failed: %s\n", observer->error.c_str());
+					return false;
+				}
+
+				*type = observer->type;
+				*sdp = observer->sdp;
+
+				return true;
+			}
+
+			static bool setDescription(webrtc::PeerConnectionInterface * pc, webrtc::SdpType type,
+				const std::string & sdp, bool local)
+			{
+				auto observer = webrtc::make_ref_counted<SetDescObserver>();
+				auto desc = webrtc::CreateSessionDescription(type, sdp);
+
+				if (local) {
+					pc->SetLocalDescription(observer.get(), desc.release());
+				}
+				else {
+					pc->SetRemoteDescription(observer.get(), desc.release());
+				}
+
+				if (!observer->done.Wait(webrtc::TimeDelta::Seconds(5)) || !observer->error.empty()) {
+					std::fprintf(stderr, "Set description failed: %s\n", observer->error.c_str());
+					return false;
+				}
+
+				return true;
+			}
+
+			PeerObserver offererObserver;
+			PeerObserver answererObserver;
+
+			webrtc::scoped_refptr<webrtc::PeerConnectionInterface> offerer;
+			webrtc::scoped_refptr<webrtc::PeerConnectionInterface> answerer;
+			webrtc::scoped_refptr<webrtc::DataChannelInterface> offererControl;
+			webrtc::scoped_refptr<webrtc::DataChannelInterface> answererControl;
+
+			std::atomic<int> connectedCount;
+			webrtc::Event connected;
+	};
+}
+
+int main(int argc, char ** argv)
+{
+	const int durationMs = argc > 1 ? std::atoi(argv[1]) : kDefaultDurationMs;
+
+	webrtc::InitializeSSL();
+
+	auto networkThread = webrtc::Thread::CreateWithSocketServer();
+	auto signalingThread = webrtc::Thread::Create();
+	auto workerThread = webrtc::Thread::Create();
+
+	networkThread->SetName("benchmark_network_thread", nullptr);
+	signalingThread->SetName("benchmark_signaling_thread", nullptr);
+	workerThread->SetName("benchmark_worker_thread", nullptr);
+
+	if (!networkThread->Start() || !signalingThread->Start() || !workerThread->Start()) {
+		std::fprintf(stderr, "Start threads failed\n");
+		return 1;
+	}
+
+	const webrtc::Environment env = webrtc::CreateEnvironment();
+
+	auto audioModule = webrtc::CreateAudioDeviceModule(env, webrtc::AudioDeviceModule::kDummyAudio);
+
+	auto factory = webrtc::CreatePeerConnectionFactory(
+		networkThread.get(),
+		workerThread.get(),
+		signalingThread.get(),
+		audioModule,
+		webrtc::CreateBuiltinAudioEncoderFactory(),
+		webrtc::CreateBuiltinAudioDecoderFactory(),
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr);
+
+	if (factory == nullptr) {
+		std::fprintf(stderr, "Create PeerConnectionFactory failed\n");
+		return 1;
+	}
+
+	int status = 0;
+
+	{
+		LoopbackConnection connection(factory.get());
+
+		if (connection.connect()) {
+			std::printf("%8s %10s %12s %6s | %10s %9s %10s %10s %12s\n",
+				"size", "ordered", "reliability", "send",
+				"msg/s", "MB/s", "p50 (us)", "p99 (us)", "cpu/msg (us)");
+
+			int channelId = 1;
+
+			for (size_t size : kMessageSizes) {
+				for (bool ordered : { true, false }) {
+					for (bool reliable : { true, false }) {
+						for (bool async : { false, true }) {
+							RunConfig config = { size, ordered, reliable, async };
+							RunResult result = connection.run(config, channelId++, durationMs);
+
+							std::printf("%8zu %10s %12s %6s | %10.0f %9.2f %10.1f %10.1f %12.2f\n",
+								size, ordered ? "true" : "false", reliable ? "reliable" : "partial",
+								async ? "async" : "sync",
+								result.messagesPerSecond(), result.megabytesPerSecond(),
+								result.latencyPercentile(0.5) / 1000.0,
+								result.latencyPercentile(0.99) / 1000.0,
+								result.cpuNanosPerMessage() / 1000.0);
+						}
+					}
+				}
+			}
+		}
+		else {
+			std::fprintf(stderr, "Loopback connection failed\n");
+			status = 1;
+		}
+	}
+
+	factory = nullptr;
+	audioModule = nullptr;
+
+	networkThread->Stop();
+	signalingThread->Stop();
+	workerThread->Stop();
+
+	webrtc::CleanupSSL();
+
+	return status;
+}
@@ -0,0 +1,93 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_AudioCaptureRing */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_AudioCaptureRing
+#define _Included_dev_onvoid_webrtc_media_audio_AudioCaptureRing
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    initialize
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_initialize
+	(JNIEnv *, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    createBuffer
+	 * Signature: ()Ljava/nio/ByteBuffer;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_createBuffer
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getWritePosition
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getWritePosition
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getReadPosition
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getReadPosition
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    setReadPosition
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_setReadPosition
+	(JNIEnv *, jobject, jlong);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getOverrunCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getOverrunCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getSampleRate
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getSampleRate
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getChannels
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getChannels
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioCaptureRing
+	 * Method:    getBytesPerSample
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getBytesPerSample
+	(JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
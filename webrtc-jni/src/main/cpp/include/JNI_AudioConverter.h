@@ -31,6 +31,22 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertInternal
 	(JNIEnv*, jobject, jbyteArray, jint, jbyteArray, jint);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioConverter
+	 * Method:    convertDirect
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioConverter
+	 * Method:    convertFloatDirect
+	 * Signature: (Ljava/nio/FloatBuffer;ILjava/nio/FloatBuffer;I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertFloatDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -215,6 +215,38 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_removeSourceInternal
 	(JNIEnv*, jobject, jlong);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase
+	 * Method:    addCaptureRingInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioCaptureRing;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_addCaptureRingInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase
+	 * Method:    removeCaptureRingInternal
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_removeCaptureRingInternal
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase
+	 * Method:    addPlaybackRingInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioPlaybackRing;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_addPlaybackRingInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase
+	 * Method:    removePlaybackRingInternal
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_removePlaybackRingInternal
+	(JNIEnv *, jobject);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase
 	 * Method:    disposeInternal
@@ -0,0 +1,77 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_AudioFileProcessor */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_AudioFileProcessor
+#define _Included_dev_onvoid_webrtc_media_audio_AudioFileProcessor
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    await
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_await
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    cancel
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_cancel
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    initialize
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioProcessingConfig;I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_initialize
+	(JNIEnv *, jobject, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    startInternal
+	 * Signature: ([Ljava/lang/String;[Ljava/lang/String;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_startInternal
+	(JNIEnv *, jobject, jobjectArray, jobjectArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    getProgressInternal
+	 * Signature: ([F)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getProgressInternal
+	(JNIEnv *, jobject, jfloatArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    getStatusInternal
+	 * Signature: (I)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getStatusInternal
+	(JNIEnv *, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioFileProcessor
+	 * Method:    getErrorInternal
+	 * Signature: (I)Ljava/lang/String;
+	 */
+	JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getErrorInternal
+	(JNIEnv *, jobject, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
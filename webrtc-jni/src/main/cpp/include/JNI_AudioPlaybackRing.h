@@ -0,0 +1,85 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_AudioPlaybackRing */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+#define _Included_dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    initialize
+	 * Signature: (II)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_initialize
+	(JNIEnv *, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    createBuffer
+	 * Signature: ()Ljava/nio/ByteBuffer;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_createBuffer
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    getWritePosition
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getWritePosition
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    setWritePosition
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_setWritePosition
+	(JNIEnv *, jobject, jlong);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    getReadPosition
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getReadPosition
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    getUnderrunCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getUnderrunCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    getSampleRate
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getSampleRate
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioPlaybackRing
+	 * Method:    getChannels
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getChannels
+	(JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
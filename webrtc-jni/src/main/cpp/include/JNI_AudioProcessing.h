@@ -33,20 +33,68 @@ extern "C" {
 
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
-	 * Method:    processStream
+	 * Method:    processStreamArray
 	 * Signature: ([BLdev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;[B)I
 	 */
-	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStream
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamArray
 	(JNIEnv*, jobject, jbyteArray, jobject, jobject, jbyteArray);
 
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
-	 * Method:    processReverseStream
+	 * Method:    processReverseStreamArray
 	 * Signature: ([BLdev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;[B)I
 	 */
-	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStream
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamArray
 	(JNIEnv*, jobject, jbyteArray, jobject, jobject, jbyteArray);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    processStreamDirect
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;II)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    processReverseStreamDirect
+	 * Signature: (Ljava/nio/ByteBuffer;ILjava/nio/ByteBuffer;II)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamDirect
+	(JNIEnv*, jobject, jobject, jint, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    processStreamFloat
+	 * Signature: (Ljava/nio/FloatBuffer;ILjava/nio/FloatBuffer;IIZ)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamFloat
+	(JNIEnv*, jobject, jobject, jint, jobject, jint, jint, jboolean);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    processReverseStreamFloat
+	 * Signature: (Ljava/nio/FloatBuffer;ILjava/nio/FloatBuffer;IIZ)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamFloat
+	(JNIEnv*, jobject, jobject, jint, jobject, jint, jint, jboolean);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    setStreamConfigInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_setStreamConfigInternal
+	(JNIEnv*, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
+	 * Method:    setReverseStreamConfigInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;Ldev/onvoid/webrtc/media/audio/AudioProcessingStreamConfig;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_setReverseStreamConfigInternal
+	(JNIEnv*, jobject, jobject, jobject);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_AudioProcessing
 	 * Method:    dispose
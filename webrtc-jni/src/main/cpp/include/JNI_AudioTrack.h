@@ -31,6 +31,62 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeSinkInternal
 	(JNIEnv *, jobject, jlong);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    addDirectSinkInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioTrackDirectSink;)J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addDirectSinkInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    removeDirectSinkInternal
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeDirectSinkInternal
+	(JNIEnv *, jobject, jlong);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    addRecorderInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioTrackRecorder;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addRecorderInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    removeRecorderInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioTrackRecorder;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeRecorderInternal
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    addLevelMeterInternal
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addLevelMeterInternal
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    removeLevelMeterInternal
+	 * Signature: (J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeLevelMeterInternal
+	(JNIEnv *, jobject, jlong);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrack
+	 * Method:    pollLevelsInternal
+	 * Signature: ([Ldev/onvoid/webrtc/media/audio/AudioTrack;[F)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_pollLevelsInternal
+	(JNIEnv *, jclass, jobjectArray, jfloatArray);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,45 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_AudioTrackRecorder */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+#define _Included_dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+	 * Method:    getWrittenFrames
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_getWrittenFrames
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+	 * Method:    getDroppedCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_getDroppedCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_AudioTrackRecorder
+	 * Method:    initialize
+	 * Signature: (Ljava/lang/String;ZI)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_initialize
+	(JNIEnv *, jobject, jstring, jboolean, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -39,6 +39,78 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudio
 	(JNIEnv *, jobject, jbyteArray, jint, jint, jint, jint);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    pushAudioDirect
+	 * Signature: (Ljava/nio/ByteBuffer;IIIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioDirect
+	(JNIEnv *, jobject, jobject, jint, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    pushAudioFloat
+	 * Signature: ([FIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioFloat
+	(JNIEnv *, jobject, jfloatArray, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    pushAudioFloatDirect
+	 * Signature: (Ljava/nio/FloatBuffer;IIII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioFloatDirect
+	(JNIEnv *, jobject, jobject, jint, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    setTargetFormatInternal
+	 * Signature: (II)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_setTargetFormatInternal
+	(JNIEnv *, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    startPacingInternal
+	 * Signature: (III)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_startPacingInternal
+	(JNIEnv *, jobject, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    stopPacing
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_stopPacing
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    getPacingBufferedFrames
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingBufferedFrames
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    getPacingUnderrunCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingUnderrunCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_CustomAudioSource
+	 * Method:    getPacingOverrunCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingOverrunCount
+	(JNIEnv *, jobject);
+
 #ifdef __cplusplus
 }
 #endif
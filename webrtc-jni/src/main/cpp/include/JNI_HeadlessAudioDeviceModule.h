@@ -11,11 +11,59 @@ extern "C" {
 	/*
 	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
 	 * Method:    initialize
-	 * Signature: ()V
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/HeadlessAudioClock;)V
 	 */
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_initialize
+	  (JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    setPlayoutTapInternal
+	 * Signature: (Ldev/onvoid/webrtc/media/audio/AudioCaptureRing;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_setPlayoutTapInternal
+	  (JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    setPlayoutTapFileInternal
+	 * Signature: (Ljava/lang/String;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_setPlayoutTapFileInternal
+	  (JNIEnv *, jobject, jstring);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    getTickCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getTickCount
+	  (JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    getAverageTickLateness
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getAverageTickLateness
 	  (JNIEnv *, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    getMaxTickLateness
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getMaxTickLateness
+	  (JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule
+	 * Method:    advanceInternal
+	 * Signature: (I)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_advanceInternal
+	  (JNIEnv *, jobject, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,62 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerObserver
 	(JNIEnv *, jobject, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    registerPoolObserver
+	 * Signature: (Ldev/onvoid/webrtc/RTCDataChannelPoolObserver;Ldev/onvoid/webrtc/RTCDataChannelBufferPool;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerPoolObserver
+	(JNIEnv *, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    registerQueuedObserver
+	 * Signature: (Ldev/onvoid/webrtc/RTCDataChannelObserver;Ldev/onvoid/webrtc/RTCDataChannelExecutor;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerQueuedObserver
+	(JNIEnv *, jobject, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    getCallbackQueueDepth
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getCallbackQueueDepth
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    setCompressionThreshold
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_setCompressionThreshold
+	(JNIEnv *, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    getCompressionStats
+	 * Signature: ()Ldev/onvoid/webrtc/RTCDataChannelCompressionStats;
+	 */
+	JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getCompressionStats
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    fillSnapshot
+	 * Signature: ([J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_fillSnapshot
+	(JNIEnv *, jobject, jlongArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannel
+	 * Method:    fillSnapshots
+	 * Signature: ([Ldev/onvoid/webrtc/RTCDataChannel;[J)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_fillSnapshots
+	(JNIEnv *, jclass, jobjectArray, jlongArray);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_RTCDataChannel
 	 * Method:    unregisterObserver
@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_RTCDataChannelBufferPool */
+
+#ifndef _Included_dev_onvoid_webrtc_RTCDataChannelBufferPool
+#define _Included_dev_onvoid_webrtc_RTCDataChannelBufferPool
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelBufferPool
+	 * Method:    getAvailable
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_getAvailable
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelBufferPool
+	 * Method:    getFallbackCount
+	 * Signature: ()J
+	 */
+	JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_getFallbackCount
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelBufferPool
+	 * Method:    initialize
+	 * Signature: ([Ljava/nio/ByteBuffer;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_initialize
+	(JNIEnv *, jobject, jobjectArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelBufferPool
+	 * Method:    releaseInternal
+	 * Signature: (I)Z
+	 */
+	JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_releaseInternal
+	(JNIEnv *, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelBufferPool
+	 * Method:    disposeInternal
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_disposeInternal
+	(JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
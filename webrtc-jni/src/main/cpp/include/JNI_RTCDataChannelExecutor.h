@@ -0,0 +1,29 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_RTCDataChannelExecutor */
+
+#ifndef _Included_dev_onvoid_webrtc_RTCDataChannelExecutor
+#define _Included_dev_onvoid_webrtc_RTCDataChannelExecutor
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelExecutor
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelExecutor_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCDataChannelExecutor
+	 * Method:    initialize
+	 * Signature: (I)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelExecutor_initialize
+	(JNIEnv *, jobject, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -224,6 +224,30 @@ extern "C" {
 	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStats__Ldev_onvoid_webrtc_RTCRtpSender_2Ldev_onvoid_webrtc_RTCStatsCollectorCallback_2
 	(JNIEnv *, jobject, jobject, jobject);
 
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
+	 * Method:    getStatsSnapshot
+	 * Signature: (Ldev/onvoid/webrtc/RTCStatsSnapshotCallback;)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsSnapshot
+	(JNIEnv *, jobject, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
+	 * Method:    getStatsId
+	 * Signature: (I)Ljava/lang/String;
+	 */
+	JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsId
+	(JNIEnv *, jobject, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
+	 * Method:    getStatsIdIndex
+	 * Signature: (Ljava/lang/String;)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsIdIndex
+	(JNIEnv *, jobject, jstring);
+
 	/*
 	 * Class:     dev_onvoid_webrtc_RTCPeerConnection
 	 * Method:    restartIce
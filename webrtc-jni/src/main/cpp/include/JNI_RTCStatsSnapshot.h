@@ -0,0 +1,29 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_RTCStatsSnapshot */
+
+#ifndef _Included_dev_onvoid_webrtc_RTCStatsSnapshot
+#define _Included_dev_onvoid_webrtc_RTCStatsSnapshot
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCStatsSnapshot
+	 * Method:    getAttributeId
+	 * Signature: (Ljava/lang/String;)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCStatsSnapshot_getAttributeId
+	(JNIEnv *, jclass, jstring);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_RTCStatsSnapshot
+	 * Method:    getAttributeName
+	 * Signature: (I)Ljava/lang/String;
+	 */
+	JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCStatsSnapshot_getAttributeName
+	(JNIEnv *, jclass, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,61 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_StreamingAudioResampler */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+#define _Included_dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_dispose
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    initialize
+	 * Signature: (III)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_initialize
+	(JNIEnv*, jobject, jint, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    getAvailableFrames
+	 * Signature: ()I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_getAvailableFrames
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    reset
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_reset
+	(JNIEnv*, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    resampleDirect
+	 * Signature: (Ljava/nio/ByteBuffer;IILjava/nio/ByteBuffer;II)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_resampleDirect
+	(JNIEnv*, jobject, jobject, jint, jint, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_StreamingAudioResampler
+	 * Method:    resampleFloatDirect
+	 * Signature: (Ljava/nio/FloatBuffer;IILjava/nio/FloatBuffer;II)I
+	 */
+	JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_resampleFloatDirect
+	(JNIEnv*, jobject, jobject, jint, jint, jobject, jint, jint);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -39,6 +39,14 @@ extern "C" {
     JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivityDetector_initialize
       (JNIEnv *, jobject);
 
+    /*
+     * Class:     dev_onvoid_webrtc_media_audio_VoiceActivityDetector
+     * Method:    segmentDirect
+     * Signature: (Ljava/nio/ByteBuffer;IIIFII)[J
+     */
+    JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivityDetector_segmentDirect
+      (JNIEnv *, jclass, jobject, jint, jint, jint, jfloat, jint, jint);
+
 #ifdef __cplusplus
 }
 #endif
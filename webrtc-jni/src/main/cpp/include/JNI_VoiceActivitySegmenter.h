@@ -0,0 +1,53 @@
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter */
+
+#ifndef _Included_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+#define _Included_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+#ifdef __cplusplus
+extern "C" {
+#endif
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+	 * Method:    dispose
+	 * Signature: ()V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_dispose
+	(JNIEnv *, jobject);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+	 * Method:    initialize
+	 * Signature: (IFII)V
+	 */
+	JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_initialize
+	(JNIEnv *, jobject, jint, jfloat, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+	 * Method:    processDirect
+	 * Signature: (Ljava/nio/ByteBuffer;II)[J
+	 */
+	JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_processDirect
+	(JNIEnv *, jobject, jobject, jint, jint);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+	 * Method:    processProbabilitiesInternal
+	 * Signature: ([F)[J
+	 */
+	JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_processProbabilitiesInternal
+	(JNIEnv *, jobject, jfloatArray);
+
+	/*
+	 * Class:     dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter
+	 * Method:    flushInternal
+	 * Signature: ()[J
+	 */
+	JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_flushInternal
+	(JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_AUDIO_TICK_SCHEDULER_H_
+#define JNI_WEBRTC_API_AUDIO_TICK_SCHEDULER_H_
+
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace jni
+{
+    // Process-wide timing thread that drives the 10 ms ticks of any number of
+    // headless audio device modules on one shared grid. Thread count and
+    // wake-ups stay constant as modules are added, instead of growing by two
+    // realtime threads per module. The thread runs only while clients are
+    // registered.
+    class AudioTickScheduler
+    {
+        public:
+            class Client
+            {
+                public:
+                    virtual ~Client() = default;
+
+                    // Called on the scheduler thread for every tick. The due time
+                    // is the grid time in microseconds (webrtc::TimeMicros) the
+                    // tick was scheduled for.
+                    virtual void OnTick(int64_t dueTimeUs) = 0;
+            };
+
+            static AudioTickScheduler & Instance();
+
+            AudioTickScheduler(const AudioTickScheduler &) = delete;
+            AudioTickScheduler & operator=(const AudioTickScheduler &) = delete;
+
+            void AddClient(Client * client);
+            // Once this returns, the client is not called anymore.
+            void RemoveClient(Client * client);
+
+            size_t ClientCount() const;
+
+        private:
+            AudioTickScheduler();
+
+            bool Process();
+
+        private:
+            // Serializes starting and stopping the thread.
+            std::mutex thread_mutex_;
+
+            // Held while clients are ticked, so that removal waits for a
+            // running tick to finish.
+            mutable webrtc::Mutex mutex_;
+            std::vector<Client *> clients_ RTC_GUARDED_BY(mutex_);
+            bool running_ RTC_GUARDED_BY(mutex_);
+
+            // Only accessed by the scheduler thread.
+            int64_t next_tick_us_;
+
+            webrtc::PlatformThread thread_;
+    };
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_AUDIO_TRACK_DIRECT_SINK_H_
+#define JNI_WEBRTC_API_AUDIO_TRACK_DIRECT_SINK_H_
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+
+#include "api/media_stream_interface.h"
+
+#include <jni.h>
+#include <cstdint>
+#include <memory>
+
+namespace jni
+{
+	// Delivers audio through a single direct ByteBuffer that is overwritten
+	// with every chunk. The buffer is only reallocated when the chunk size
+	// changes, so that steady-state delivery allocates nothing.
+	class AudioTrackDirectSink : public webrtc::AudioTrackSinkInterface
+	{
+		public:
+			AudioTrackDirectSink(JNIEnv * env, const JavaGlobalRef<jobject> & sink);
+			~AudioTrackDirectSink() = default;
+
+			// AudioTrackSinkInterface implementation.
+			void OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels, size_t frames) override;
+
+		private:
+			void allocate(JNIEnv * env, size_t size);
+
+		private:
+			class JavaAudioTrackDirectSinkClass : public JavaClass
+			{
+				public:
+					explicit JavaAudioTrackDirectSinkClass(JNIEnv * env);
+
+					jmethodID onData;
+					jmethodID clear;
+					jmethodID order;
+					jclass byteOrderClass;
+					jmethodID nativeOrder;
+			};
+
+		private:
+			JavaGlobalRef<jobject> sink;
+			JavaGlobalRef<jobject> buffer;
+
+			std::unique_ptr<uint8_t[]> memory;
+			size_t capacity;
+
+			const std::shared_ptr<JavaAudioTrackDirectSinkClass> javaClass;
+	};
+}
+
+#endif
@@ -17,8 +17,10 @@
 #ifndef JNI_WEBRTC_API_HEADLESS_ADM_H_
 #define JNI_WEBRTC_API_HEADLESS_ADM_H_
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
@@ -36,25 +38,44 @@
 #include "rtc_base/thread.h"
 #include "rtc_base/time_utils.h"
 
+#include "api/AudioTickScheduler.h"
+#include "media/audio/AudioSink.h"
+
 namespace jni
 {
     // A headless AudioDeviceModule that drives the render pipeline by pulling
-    // 10 ms PCM chunks from AudioTransport and discarding them, and simulates
+    // 10 ms PCM chunks from AudioTransport and discarding them, or passing them
+    // to an optional playout tap, and simulates
     // a microphone by pulling 10 ms PCM chunks from the registered AudioTransport
     // and feeding them into the WebRTC capture pipeline.
-    class HeadlessAudioDeviceModule : public webrtc::AudioDeviceModule
+    //
+    // By default the module runs its own realtime playout and capture threads.
+    // With ClockMode::kShared both directions are ticked by the process-wide
+    // AudioTickScheduler instead. With ClockMode::kManual no thread is used and
+    // ticks are only processed by calls to Advance(), which allows running
+    // faster than realtime.
+    class HeadlessAudioDeviceModule : public webrtc::AudioDeviceModule, private AudioTickScheduler::Client
     {
         public:
+            enum class ClockMode
+            {
+                kRealtime,
+                kShared,
+                kManual
+            };
+
             static webrtc::scoped_refptr<HeadlessAudioDeviceModule> Create(
                     const webrtc::Environment & env,
                     int sample_rate_hz = 48000,
-                    size_t channels = 1)
+                    size_t channels = 1,
+                    ClockMode clock_mode = ClockMode::kRealtime)
             {
                 return webrtc::make_ref_counted<HeadlessAudioDeviceModule>(
-                        env, sample_rate_hz, channels);
+                        env, sample_rate_hz, channels, clock_mode);
             }
 
-            HeadlessAudioDeviceModule(const webrtc::Environment & env, int sample_rate_hz, size_t channels);
+            HeadlessAudioDeviceModule(const webrtc::Environment & env, int sample_rate_hz, size_t channels,
+                                      ClockMode clock_mode = ClockMode::kRealtime);
             ~HeadlessAudioDeviceModule() override;
 
             // ----- AudioDeviceModule interface -----
@@ -146,10 +167,48 @@ namespace jni
             // Android-only in real ADMs; just return 0 here.
             int32_t GetPlayoutUnderrunCount() const override;
 
+            // --- Playout tap ---
+            // Passes the mixed playout audio of every 10 ms tick to the tap. The
+            // tap is not owned and must outlive its registration. Pass nullptr
+            // to remove the tap.
+            void SetPlayoutTap(AudioSink * tap);
+            // Writes the mixed playout audio to a WAV file in the playout format.
+            // The channel count cannot be changed while the file is set.
+            void SetPlayoutTapFile(const std::string & fileName);
+
+            // --- Manual clock ---
+            // Processes the given number of 10 ms ticks on the calling thread,
+            // capture before playout. Returns the number of processed ticks,
+            // which is less than requested if neither playout nor recording is
+            // active, and 0 if this module does not use ClockMode::kManual.
+            size_t Advance(size_t ticks);
+
+            // --- Tick metrics ---
+            // Lateness is the delay between the time a 10 ms tick was due and
+            // the time it was processed.
+            uint64_t GetTickCount() const;
+            int64_t GetAverageTickLatenessUs() const;
+            int64_t GetMaxTickLatenessUs() const;
+
         private:
+            // AudioTickScheduler::Client implementation.
+            void OnTick(int64_t dueTimeUs) override;
+
+            // Fails if a playout tap file requires the current channel count.
+            bool SetChannels(size_t channels) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+            void UpdateTickRegistration();
+            void RecordTickLateness(int64_t latenessUs);
+
+            // Process one 10 ms chunk of playout and capture, respectively.
+            void PlayTick();
+            void CaptureTick();
+
             bool PlayThreadProcess();
             bool CaptureThreadProcess();
 
+            const ClockMode clock_mode_;
+
             // State
             bool initialized_ = false;
             bool playout_initialized_ = false;
@@ -176,8 +235,20 @@ namespace jni
             std::unique_ptr<webrtc::AudioDeviceBuffer> audio_device_buffer_ RTC_GUARDED_BY(mutex_);
             webrtc::AudioTransport * audio_callback_;
 
+            AudioSink * playout_tap_ RTC_GUARDED_BY(mutex_);
+            std::unique_ptr<AudioSink> playout_file_tap_ RTC_GUARDED_BY(mutex_);
+
             webrtc::PlatformThread render_thread_;
             webrtc::PlatformThread capture_thread_;
+
+            // Shared clock registration.
+            std::mutex registration_mutex_;
+            std::mutex tick_mutex_;
+            bool registered_;
+
+            std::atomic<uint64_t> tick_count_;
+            std::atomic<int64_t> tick_lateness_sum_us_;
+            std::atomic<int64_t> max_tick_lateness_us_;
     };
 }
 
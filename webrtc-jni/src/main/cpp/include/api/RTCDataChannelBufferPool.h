@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_BUFFER_POOL_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_BUFFER_POOL_H_
+
+#include "JavaRef.h"
+
+#include "api/ref_count.h"
+
+#include <atomic>
+#include <cstdint>
+#include <jni.h>
+#include <memory>
+#include <vector>
+
+namespace jni
+{
+	// A fixed set of caller-supplied direct ByteBuffers that incoming data
+	// channel messages are copied into. Buffers are claimed round-robin by
+	// the network thread and handed back by Java once the message has been
+	// consumed. Claiming and releasing a buffer is lock-free.
+	class RTCDataChannelBufferPool : public webrtc::RefCountInterface
+	{
+		public:
+			RTCDataChannelBufferPool(JNIEnv * env, const JavaRef<jobjectArray> & buffers);
+			~RTCDataChannelBufferPool() = default;
+
+			// Copies the data into the next free buffer that is large enough.
+			// Returns the index of the claimed buffer, or -1 if no such buffer
+			// is available.
+			int acquire(const uint8_t * data, size_t size);
+
+			// Marks the buffer at the given index as free again. Returns false
+			// if the index is out of range or the buffer is not claimed.
+			bool release(int index);
+
+			size_t getSize() const;
+			size_t getAvailable() const;
+			uint64_t getFallbackCount() const;
+
+		private:
+			std::vector<JavaGlobalRef<jobject>> buffers;
+			std::vector<uint8_t *> addresses;
+			std::vector<size_t> capacities;
+			std::unique_ptr<std::atomic<bool>[]> claimed;
+
+			std::atomic<size_t> cursor;
+			std::atomic<uint64_t> fallbackCount;
+	};
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_COMPRESSOR_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_COMPRESSOR_H_
+
+#include "api/ref_count.h"
+#include "rtc_base/copy_on_write_buffer.h"
+
+#include "third_party/zlib/zlib.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+namespace jni
+{
+	// Transparent per-channel payload compression. Compression is enabled
+	// when the channel protocol contains the kProtocolToken, which both peers
+	// see after negotiation. Every payload is prefixed with one byte telling
+	// whether the rest is raw or raw-deflate data, so that messages below the
+	// size threshold or not worth compressing are sent as they are.
+	class RTCDataChannelCompressor : public webrtc::RefCountInterface
+	{
+		public:
+			struct Stats
+			{
+				uint64_t messagesSent;
+				uint64_t messagesCompressed;
+				uint64_t bytesSent;
+				uint64_t wireBytesSent;
+				uint64_t messagesReceived;
+				uint64_t bytesReceived;
+				uint64_t wireBytesReceived;
+			};
+
+			static constexpr std::string_view kProtocolToken = "webrtc-java-deflate";
+
+			// Messages smaller than this are not compressed by default.
+			static constexpr size_t kDefaultThreshold = 256;
+
+			// Returns true if the comma separated protocol list contains the
+			// compression token.
+			static bool isRequested(std::string_view protocol);
+
+			explicit RTCDataChannelCompressor(bool enabled);
+			~RTCDataChannelCompressor();
+
+			bool isEnabled() const;
+
+			void setThreshold(size_t threshold);
+
+			// Builds the wire payload for the given message.
+			webrtc::CopyOnWriteBuffer compress(const uint8_t * data, size_t size);
+
+			// Restores the message from a wire payload. Returns false if the
+			// payload is malformed.
+			bool decompress(const webrtc::CopyOnWriteBuffer & payload, webrtc::CopyOnWriteBuffer * data);
+
+			Stats getStats() const;
+
+		private:
+			webrtc::CopyOnWriteBuffer frameRaw(const uint8_t * data, size_t size);
+
+		private:
+			const bool enabled;
+
+			std::atomic<size_t> threshold;
+
+			std::mutex deflateMutex;
+			z_stream deflateStream;
+
+			std::mutex inflateMutex;
+			z_stream inflateStream;
+
+			std::atomic<uint64_t> messagesSent;
+			std::atomic<uint64_t> messagesCompressed;
+			std::atomic<uint64_t> bytesSent;
+			std::atomic<uint64_t> wireBytesSent;
+			std::atomic<uint64_t> messagesReceived;
+			std::atomic<uint64_t> bytesReceived;
+			std::atomic<uint64_t> wireBytesReceived;
+	};
+}
+
+#endif
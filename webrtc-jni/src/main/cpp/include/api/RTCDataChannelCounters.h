@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_COUNTERS_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_COUNTERS_H_
+
+#include "api/data_channel_interface.h"
+#include "api/ref_count.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace jni
+{
+	// Message counters of a data channel, maintained by the send paths and the
+	// registered observer. The counters of the DataChannelInterface are
+	// proxied to the network thread, these can be read from any thread without
+	// blocking. Sizes are counted as transmitted, after compression.
+	class RTCDataChannelCounters : public webrtc::RefCountInterface
+	{
+		public:
+			RTCDataChannelCounters();
+			~RTCDataChannelCounters() = default;
+
+			void countSent(size_t size);
+			void countReceived(size_t size);
+
+			uint64_t getMessagesSent() const;
+			uint64_t getBytesSent() const;
+			uint64_t getMessagesReceived() const;
+			uint64_t getBytesReceived() const;
+
+			// Returns the channel id, which is cached once it has been
+			// assigned, since it never changes afterwards.
+			int getId(webrtc::DataChannelInterface * channel);
+
+		private:
+			std::atomic<uint64_t> messagesSent;
+			std::atomic<uint64_t> bytesSent;
+			std::atomic<uint64_t> messagesReceived;
+			std::atomic<uint64_t> bytesReceived;
+			std::atomic<int> id;
+	};
+}
+
+#endif
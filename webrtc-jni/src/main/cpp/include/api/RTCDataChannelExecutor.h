@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_EXECUTOR_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_EXECUTOR_H_
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/platform_thread.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jni
+{
+	// A shared pool of worker threads running data channel callbacks off the
+	// network thread. Callbacks are posted to serial queues, one per data
+	// channel. A queue is processed by at most one worker at a time, so the
+	// callbacks of a channel keep their order while different channels are
+	// dispatched in parallel.
+	class RTCDataChannelExecutor : public webrtc::RefCountInterface
+	{
+		public:
+			class SerialQueue : public webrtc::RefCountInterface
+			{
+				public:
+					explicit SerialQueue(webrtc::scoped_refptr<RTCDataChannelExecutor> executor);
+					~SerialQueue() = default;
+
+					// Enqueues a task. Tasks posted after the executor has
+					// been shut down or the queue has been closed are dropped.
+					void post(std::function<void()> task);
+
+					// Drops all pending tasks and rejects new ones. Waits for
+					// a running task to complete, unless called from within
+					// that task.
+					void close();
+
+					// Returns the number of tasks waiting to be run.
+					size_t getDepth() const;
+
+				private:
+					friend class RTCDataChannelExecutor;
+
+					// Runs the pending tasks. Returns true if new tasks were
+					// posted meanwhile and the queue needs to be scheduled
+					// again.
+					bool run();
+
+					// Drops all pending tasks once the executor is shut down.
+					void clear();
+
+				private:
+					webrtc::scoped_refptr<RTCDataChannelExecutor> executor;
+
+					mutable std::mutex mutex;
+					std::condition_variable idle;
+					std::deque<std::function<void()>> tasks;
+					std::thread::id runner;
+					bool scheduled;
+					bool closed;
+			};
+
+		public:
+			explicit RTCDataChannelExecutor(size_t threadCount);
+			~RTCDataChannelExecutor();
+
+			webrtc::scoped_refptr<SerialQueue> createQueue();
+
+			// Stops and joins all worker threads. Pending tasks are dropped.
+			void shutdown();
+
+		private:
+			bool schedule(webrtc::scoped_refptr<SerialQueue> queue);
+			void process();
+
+		private:
+			std::vector<webrtc::PlatformThread> workers;
+
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::deque<webrtc::scoped_refptr<SerialQueue>> readyQueues;
+			bool running;
+	};
+}
+
+#endif
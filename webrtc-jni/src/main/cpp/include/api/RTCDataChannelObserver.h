@@ -20,7 +20,10 @@
 #include "JavaClass.h"
 #include "JavaRef.h"
 
+#include "api/RTCDataChannelCompressor.h"
+#include "api/RTCDataChannelCounters.h"
 #include "api/data_channel_interface.h"
+#include "api/scoped_refptr.h"
 #include <api/DataBufferFactory.h>
 
 #include <jni.h>
@@ -31,7 +34,9 @@ namespace jni
 	class RTCDataChannelObserver : public webrtc::DataChannelObserver
 	{
 		public:
-			explicit RTCDataChannelObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer);
+			explicit RTCDataChannelObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+				webrtc::scoped_refptr<RTCDataChannelCompressor> compressor = nullptr,
+				webrtc::scoped_refptr<RTCDataChannelCounters> counters = nullptr);
 			~RTCDataChannelObserver() = default;
 
 			// DataChannelObserver implementation.
@@ -39,6 +44,21 @@ namespace jni
 			void OnMessage(const webrtc::DataBuffer & buffer) override;
 			void OnBufferedAmountChange(uint64_t sent_data_size) override;
 
+		protected:
+			// Counts a message as it arrives from the network.
+			void countReceived(const webrtc::DataBuffer & buffer);
+
+			// Decodes a message and passes it to the Java observer.
+			void deliverMessage(const webrtc::DataBuffer & buffer);
+
+			// Returns the message carried by the buffer, which is either the
+			// buffer itself or, on a compressed channel, the decompressed
+			// copy stored in 'decoded'. Returns nullptr for malformed data.
+			const webrtc::DataBuffer * decode(const webrtc::DataBuffer & buffer, webrtc::DataBuffer * decoded);
+
+			// Passes a decoded message to the Java observer.
+			void dispatchMessage(const webrtc::DataBuffer & buffer);
+
 		private:
 			class JavaRTCDataChannelObserverClass : public JavaClass
 			{
@@ -50,11 +70,15 @@ namespace jni
 					jmethodID onBufferedAmountChange;
 			};
 
-		private:
+		protected:
 			JavaGlobalRef<jobject> observer;
 
 			std::unique_ptr<DataBufferFactory> bufferFactory;
 
+			webrtc::scoped_refptr<RTCDataChannelCompressor> compressor;
+
+			webrtc::scoped_refptr<RTCDataChannelCounters> counters;
+
 			const std::shared_ptr<JavaRTCDataChannelObserverClass> javaClass;
 	};
 }
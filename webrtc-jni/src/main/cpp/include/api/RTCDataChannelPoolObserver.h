@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_POOL_OBSERVER_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_POOL_OBSERVER_H_
+
+#include "api/RTCDataChannelBufferPool.h"
+#include "api/RTCDataChannelObserver.h"
+
+#include "api/scoped_refptr.h"
+
+#include <jni.h>
+#include <memory>
+
+namespace jni
+{
+	// Delivers incoming messages through a caller-supplied buffer pool. If the
+	// pool has no free buffer large enough for a message, the message is
+	// delivered through the regular onMessage path instead.
+	class RTCDataChannelPoolObserver : public RTCDataChannelObserver
+	{
+		public:
+			RTCDataChannelPoolObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+				webrtc::scoped_refptr<RTCDataChannelBufferPool> pool,
+				webrtc::scoped_refptr<RTCDataChannelCompressor> compressor = nullptr,
+				webrtc::scoped_refptr<RTCDataChannelCounters> counters = nullptr);
+			~RTCDataChannelPoolObserver() = default;
+
+			// DataChannelObserver implementation.
+			void OnMessage(const webrtc::DataBuffer & buffer) override;
+
+		private:
+			class JavaRTCDataChannelPoolObserverClass : public JavaClass
+			{
+				public:
+					explicit JavaRTCDataChannelPoolObserverClass(JNIEnv * env);
+
+					jmethodID onPooledMessage;
+			};
+
+		private:
+			webrtc::scoped_refptr<RTCDataChannelBufferPool> pool;
+
+			const std::shared_ptr<JavaRTCDataChannelPoolObserverClass> javaPoolClass;
+	};
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_QUEUED_OBSERVER_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_QUEUED_OBSERVER_H_
+
+#include "api/RTCDataChannelExecutor.h"
+#include "api/RTCDataChannelObserver.h"
+
+#include "api/scoped_refptr.h"
+
+#include <jni.h>
+
+namespace jni
+{
+	// Dispatches all callbacks through a serial queue of an executor, so
+	// that Java code never runs on the network thread. Messages keep their
+	// order relative to each other and to state changes.
+	class RTCDataChannelQueuedObserver : public RTCDataChannelObserver
+	{
+		public:
+			RTCDataChannelQueuedObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+				webrtc::scoped_refptr<RTCDataChannelExecutor::SerialQueue> queue,
+				webrtc::scoped_refptr<RTCDataChannelCompressor> compressor = nullptr,
+				webrtc::scoped_refptr<RTCDataChannelCounters> counters = nullptr);
+			~RTCDataChannelQueuedObserver() = default;
+
+			// DataChannelObserver implementation.
+			void OnStateChange() override;
+			void OnMessage(const webrtc::DataBuffer & buffer) override;
+			void OnBufferedAmountChange(uint64_t sent_data_size) override;
+
+		private:
+			webrtc::scoped_refptr<RTCDataChannelExecutor::SerialQueue> queue;
+	};
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_API_RTC_DATA_CHANNEL_SNAPSHOT_H_
+#define JNI_WEBRTC_API_RTC_DATA_CHANNEL_SNAPSHOT_H_
+
+#include "JavaClass.h"
+
+#include <jni.h>
+
+namespace jni
+{
+	// Fills the state snapshot of data channels. The slot layout must match
+	// the SNAPSHOT_* constants of the Java RTCDataChannel.
+	namespace RTCDataChannelSnapshot
+	{
+		constexpr jsize kState = 0;
+		constexpr jsize kBufferedAmount = 1;
+		constexpr jsize kMessagesSent = 2;
+		constexpr jsize kBytesSent = 3;
+		constexpr jsize kMessagesReceived = 4;
+		constexpr jsize kBytesReceived = 5;
+		constexpr jsize kId = 6;
+		constexpr jsize kSize = 7;
+
+		class JavaRTCDataChannelClass : public JavaClass
+		{
+			public:
+				explicit JavaRTCDataChannelClass(JNIEnv * env);
+
+				jfieldID nativeHandle;
+				jfieldID countersHandle;
+		};
+
+		// Writes kSize values for the channel into 'out'. A null or disposed
+		// channel is reported with state -1.
+		void fill(JNIEnv * env, const JavaRTCDataChannelClass & javaClass, jobject channel, jlong * out);
+	}
+}
+
+#endif
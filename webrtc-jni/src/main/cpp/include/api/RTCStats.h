@@ -59,6 +59,9 @@ namespace jni
 				jmethodID ctor;
 		};
 
+		// Returns the ordinal of the Java RTCStatsType, or -1 if there is none.
+		int toTypeIndex(const webrtc::RTCStats & stats);
+
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::RTCStats & stats);
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::Attribute & attribute);
 	}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_WEBRTC_API_RTC_STATS_SNAPSHOT_H_
+#define JNI_WEBRTC_API_RTC_STATS_SNAPSHOT_H_
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+
+#include "api/ref_count.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats_report.h"
+
+#include <deque>
+#include <jni.h>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace jni
+{
+	// Assigns stable indices to strings. Strings are never removed, so an
+	// index stays valid for the lifetime of the table.
+	class RTCStatsStringTable : public webrtc::RefCountInterface
+	{
+		public:
+			RTCStatsStringTable() = default;
+			~RTCStatsStringTable() = default;
+
+			// Returns the index of the string, or -1 if it is not in the table.
+			int find(std::string_view value);
+			std::optional<std::string> get(int index);
+
+			// Returns the index of the string, adding it if required. Must be
+			// called with the mutex held, so that a whole report is interned
+			// with a single lock.
+			int intern(std::string_view value);
+
+			std::mutex & getMutex();
+
+		private:
+			std::mutex mutex;
+			// Views into the deque, which does not move its elements.
+			std::deque<std::string> values;
+			std::unordered_map<std::string_view, int> indices;
+	};
+
+	// Converts a stats report into a columnar RTCStatsSnapshot. Numeric
+	// attributes are stored in flat long and double arrays and keyed by
+	// attribute IDs. The attribute names of all WebRTC stats types are
+	// interned once per process. Stats object IDs are interned per peer
+	// connection, so that a snapshot consists of a handful of arrays instead
+	// of one object per stats object and attribute. Strings, arrays and maps
+	// are not part of a snapshot.
+	namespace RTCStatsSnapshot
+	{
+		class JavaRTCStatsSnapshotClass : public JavaClass
+		{
+			public:
+				explicit JavaRTCStatsSnapshotClass(JNIEnv * env);
+
+				jclass cls;
+				jmethodID ctor;
+		};
+
+		// Returns the ID of the attribute name, or -1 for unknown names.
+		int getAttributeId(std::string_view name);
+		std::optional<std::string> getAttributeName(int id);
+
+		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::scoped_refptr<const webrtc::RTCStatsReport> & report,
+			RTCStatsStringTable & idTable);
+	}
+}
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_WEBRTC_API_RTC_STATS_SNAPSHOT_CALLBACK_H_
+#define JNI_WEBRTC_API_RTC_STATS_SNAPSHOT_CALLBACK_H_
+
+#include "JavaClass.h"
+#include "JavaRef.h"
+#include "api/RTCStatsSnapshot.h"
+
+#include "api/stats/rtc_stats_collector_callback.h"
+
+#include <jni.h>
+#include <memory>
+
+namespace jni
+{
+	class RTCStatsSnapshotCallback : public webrtc::RTCStatsCollectorCallback
+	{
+		public:
+			RTCStatsSnapshotCallback(JNIEnv * env, const JavaGlobalRef<jobject> & callback,
+				webrtc::scoped_refptr<RTCStatsStringTable> idTable);
+			~RTCStatsSnapshotCallback() = default;
+
+			void OnStatsDelivered(const webrtc::scoped_refptr<const webrtc::RTCStatsReport> & report) override;
+
+		private:
+			class JavaRTCStatsSnapshotCallbackClass : public JavaClass
+			{
+				public:
+					explicit JavaRTCStatsSnapshotCallbackClass(JNIEnv * env);
+
+					jmethodID onStatsSnapshot;
+			};
+
+		private:
+			JavaGlobalRef<jobject> callback;
+
+			// The stats IDs of the peer connection.
+			webrtc::scoped_refptr<RTCStatsStringTable> idTable;
+
+			const std::shared_ptr<JavaRTCStatsSnapshotCallbackClass> javaClass;
+	};
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_CAPTURE_RING_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_CAPTURE_RING_H_
+
+#include "AudioSink.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace jni
+{
+	// Single-producer/single-consumer ring of captured PCM audio. The capture
+	// thread copies each chunk into the ring and publishes it by advancing the
+	// write position; it never calls into the JVM and never blocks. Java reads
+	// the ring memory through a direct buffer and advances the read position.
+	// Positions are byte counts that only grow; the ring offset is the
+	// position modulo the capacity.
+	class AudioCaptureRing : public AudioSink
+	{
+		public:
+			explicit AudioCaptureRing(size_t capacity);
+			~AudioCaptureRing() = default;
+
+			int32_t RecordedDataIsAvailable(
+				const void * audioSamples,
+				const size_t nSamples,
+				const size_t nBytesPerSample,
+				const size_t nChannels,
+				const uint32_t samplesPerSec,
+				const uint32_t totalDelayMS,
+				const int32_t clockDrift,
+				const uint32_t currentMicLevel,
+				const bool keyPressed,
+				uint32_t & newMicLevel) override;
+
+			uint8_t * data() const;
+			size_t getCapacity() const;
+
+			uint64_t getWritePosition() const;
+			uint64_t getReadPosition() const;
+			void setReadPosition(uint64_t position);
+
+			uint64_t getOverrunCount() const;
+
+			uint32_t getSampleRate() const;
+			size_t getChannels() const;
+			size_t getBytesPerSample() const;
+
+		private:
+			const size_t capacity;
+			const std::unique_ptr<uint8_t[]> memory;
+
+			// Written by the capture thread, read by Java.
+			alignas(64) std::atomic<uint64_t> writePosition;
+			// Written by Java, read by the capture thread.
+			alignas(64) std::atomic<uint64_t> readPosition;
+
+			std::atomic<uint64_t> overrunCount;
+			std::atomic<uint32_t> sampleRate;
+			std::atomic<size_t> channels;
+			std::atomic<size_t> bytesPerSample;
+	};
+}
+
+#endif
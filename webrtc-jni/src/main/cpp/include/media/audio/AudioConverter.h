@@ -17,13 +17,24 @@
 #ifndef JNI_WEBRTC_MEDIA_AUDIO_CONVERTER_H_
 #define JNI_WEBRTC_MEDIA_AUDIO_CONVERTER_H_
 
-#include "JavaClass.h"
-#include "JavaRef.h"
+#include "common_audio/resampler/push_sinc_resampler.h"
 
-#include <jni.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace jni
 {
+	// Remixes and resamples interleaved 10 ms frames of 16-bit or float audio.
+	// The conversion runs in at most three passes over the frame, using planar
+	// float scratch buffers that are allocated once and reused for every
+	// frame: the input is deinterleaved into the scratch buffers and
+	// down-mixed in the same pass, each channel is resampled with
+	// the vectorized sinc resampler kernels, and the result is up-mixed and
+	// interleaved directly into the output. Mixing always happens on the side
+	// with fewer channels, so that no more channels than necessary are
+	// resampled.
 	class AudioConverter
 	{
 		public:
@@ -31,27 +42,56 @@ namespace jni
 			AudioConverter& operator=(const AudioConverter&) = delete;
 
 			static std::unique_ptr<AudioConverter> create(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels);
-			
-			virtual ~AudioConverter() = default;
 
-			virtual void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) = 0;
+			~AudioConverter();
+
+			// Sizes are given in samples of all channels. Float samples may
+			// have any scale, typically [-1, 1].
+			void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize);
+			void convert(const float * src, size_t srcSize, float * dst, size_t dstSize);
 
 			size_t getSrcChannels() const { return srcChannels; }
 			size_t getSrcFrames() const { return srcFrames; }
 			size_t getDstChannels() const { return dstChannels; }
 			size_t getDstFrames() const { return dstFrames; }
 
-		protected:
-			AudioConverter();
+		private:
 			AudioConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels);
 
+			template <typename T>
+			void convertFrame(const T * src, size_t srcSize, T * dst, size_t dstSize);
+
+			// Deinterleaves the input and down-mixes it, if required.
+			template <typename T>
+			void deinterleave(const T * src);
+
+			// Resamples every planar channel.
+			void resample();
+
+			// Up-mixes the planar channels, if required, and interleaves them.
+			template <typename T>
+			void interleave(const float * planar, T * dst);
+
 			void checkSizes(size_t srcSize, size_t dstCapacity) const;
 
 			const size_t srcFrames;
 			const size_t srcChannels;
 			const size_t dstFrames;
 			const size_t dstChannels;
+
+			// The number of planar channels between the passes.
+			const size_t planarChannels;
+
+			// Row-major mixing matrix with one row per output channel. Empty if
+			// the channel count does not change.
+			std::vector<float> mixMatrix;
+
+			std::vector<float> srcPlanar;
+			std::vector<float> dstPlanar;
+
+			// One resampler per planar channel. Empty if the rate does not change.
+			std::vector<std::unique_ptr<webrtc::PushSincResampler>> resamplers;
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_FILE_PROCESSOR_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_FILE_PROCESSOR_H_
+
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment.h"
+#include "rtc_base/platform_thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace jni
+{
+	// Runs audio processing over WAV files on a pool of worker threads. Each
+	// file is processed by its own webrtc::AudioProcessing instance, so files
+	// are independent and throughput scales with the number of workers. The
+	// audio is read and written in blocks of one second.
+	class AudioFileProcessor
+	{
+		public:
+			enum class Status { kPending, kProcessing, kCompleted, kFailed };
+
+			AudioFileProcessor(const webrtc::Environment & environment, const webrtc::AudioProcessing::Config & config,
+				size_t workerCount);
+			// Cancels pending files and waits for the workers to finish.
+			~AudioFileProcessor();
+
+			// Starts processing the input files into the output files.
+			void start(const std::vector<std::string> & inputFiles, const std::vector<std::string> & outputFiles);
+
+			// Blocks until all files are processed or processing is cancelled.
+			void wait();
+
+			// Stops processing, files that are not completed are marked failed.
+			void cancel();
+
+			size_t getFileCount() const;
+			float getProgress(size_t index) const;
+			Status getStatus(size_t index) const;
+			// Returns an empty string unless the file failed.
+			std::string getError(size_t index) const;
+
+		private:
+			struct File
+			{
+				std::string input;
+				std::string output;
+				std::string error;
+				std::atomic<Status> status;
+				std::atomic<uint64_t> processedFrames;
+				std::atomic<uint64_t> totalFrames;
+			};
+
+			// The worker thread loop.
+			void run();
+
+			// Throws jni::Exception on failure.
+			void processFile(File & file);
+
+		private:
+			const webrtc::Environment environment;
+			const webrtc::AudioProcessing::Config config;
+			const size_t workerCount;
+
+			std::vector<std::unique_ptr<File>> files;
+			std::atomic<size_t> nextFile;
+			std::atomic<bool> cancelled;
+
+			std::mutex threadMutex;
+			std::vector<webrtc::PlatformThread> workers;
+	};
+}
+
+#endif
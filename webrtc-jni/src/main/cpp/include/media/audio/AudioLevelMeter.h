@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_LEVEL_METER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_LEVEL_METER_H_
+
+#include "api/media_stream_interface.h"
+
+#include <atomic>
+#include <cstddef>
+
+namespace jni
+{
+	// Measures the level of the audio of a track on the audio thread. The
+	// results are kept in atomics, so they can be read from any thread
+	// without receiving the audio itself. All levels are relative to full
+	// scale.
+	class AudioLevelMeter : public webrtc::AudioTrackSinkInterface
+	{
+		public:
+			AudioLevelMeter();
+			~AudioLevelMeter() = default;
+
+			// AudioTrackSinkInterface implementation.
+			void OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels,
+				size_t frames) override;
+
+			// The RMS level of the last chunk in the range [0, 1].
+			float getRms() const;
+
+			// The peak level since the last call in the range [0, 1].
+			float takePeak();
+
+			// The mean square level of the last 400 ms in dBFS.
+			float getLoudness() const;
+
+		private:
+			std::atomic<float> rms;
+			std::atomic<float> peak;
+			std::atomic<float> loudness;
+
+			// Smoothed mean square, only accessed on the audio thread.
+			float meanSquare;
+	};
+}
+
+#endif
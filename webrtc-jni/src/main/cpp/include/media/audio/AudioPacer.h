@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_PACER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_PACER_H_
+
+#include "media/SyncClock.h"
+
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace jni
+{
+	// Rechunks 16-bit PCM audio of arbitrary chunk sizes into exact 10 ms
+	// frames and emits them from its own thread at a steady 10 ms cadence
+	// taken from the given clock. If less than 10 ms of audio is buffered when
+	// a frame is due, the frame is padded with silence and counted as
+	// underrun. Audio that does not fit into the buffer is dropped and
+	// counted as overrun.
+	class AudioPacer
+	{
+		public:
+			using FrameCallback = std::function<void(const int16_t * data, size_t frames)>;
+
+			AudioPacer(int sampleRate, size_t channels, size_t capacityFrames,
+				std::shared_ptr<SyncClock> clock, FrameCallback callback);
+			~AudioPacer();
+
+			void start();
+			void stop();
+
+			// Returns the number of frames that have been buffered.
+			size_t write(const int16_t * data, size_t frames);
+
+			int getSampleRate() const;
+			size_t getChannels() const;
+			size_t getCapacityFrames() const;
+			size_t getBufferedFrames() const;
+			uint64_t getUnderrunCount() const;
+			uint64_t getOverrunCount() const;
+
+		private:
+			bool process();
+			void emitFrame();
+
+		private:
+			const int sampleRate;
+			const size_t channels;
+			const size_t framesIn10MS;
+			const std::shared_ptr<SyncClock> clock;
+			const FrameCallback callback;
+
+			mutable webrtc::Mutex mutex;
+			std::vector<int16_t> ring;
+			size_t readIndex;
+			size_t bufferedSamples;
+			// Set once the first audio has been written, so that silence
+			// before the first write is not counted as underrun.
+			bool primed;
+
+			// Only accessed by the pacer thread.
+			std::vector<int16_t> frame;
+			int64_t nextFrameUs;
+
+			std::atomic<bool> running;
+			std::atomic<uint64_t> underrunCount;
+			std::atomic<uint64_t> overrunCount;
+
+			webrtc::PlatformThread thread;
+	};
+}
+
+#endif
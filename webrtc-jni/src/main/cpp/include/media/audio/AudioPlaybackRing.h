@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_PLAYBACK_RING_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_PLAYBACK_RING_H_
+
+#include "AudioSource.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace jni
+{
+	// Single-producer/single-consumer ring of PCM audio to be played. Java
+	// writes ahead into the ring memory through a direct buffer and publishes
+	// the data by advancing the write position. The playout thread only reads
+	// from the ring and never calls into the JVM. Playback starts once the
+	// prefill level is reached; missing data is replaced with silence, counted
+	// as underrun and followed by another prefill phase. Positions are byte
+	// counts that only grow.
+	class AudioPlaybackRing : public AudioSource
+	{
+		public:
+			AudioPlaybackRing(size_t capacity, size_t prefill);
+			~AudioPlaybackRing() = default;
+
+			int32_t NeedMorePlayData(
+				const size_t nSamples,
+				const size_t nBytesPerSample,
+				const size_t nChannels,
+				const uint32_t samplesPerSec,
+				void * audioSamples,
+				size_t & nSamplesOut,
+				int64_t * elapsed_time_ms,
+				int64_t * ntp_time_ms) override;
+
+			uint8_t * data() const;
+			size_t getCapacity() const;
+			size_t getPrefill() const;
+
+			uint64_t getWritePosition() const;
+			void setWritePosition(uint64_t position);
+			uint64_t getReadPosition() const;
+
+			uint64_t getUnderrunCount() const;
+
+			uint32_t getSampleRate() const;
+			size_t getChannels() const;
+
+		private:
+			const size_t capacity;
+			const size_t prefill;
+			const std::unique_ptr<uint8_t[]> memory;
+
+			// Written by Java, read by the playout thread.
+			alignas(64) std::atomic<uint64_t> writePosition;
+			// Written by the playout thread, read by Java.
+			alignas(64) std::atomic<uint64_t> readPosition;
+
+			// Only accessed by the playout thread.
+			bool primed;
+
+			std::atomic<uint64_t> underrunCount;
+			std::atomic<uint32_t> sampleRate;
+			std::atomic<size_t> channels;
+	};
+}
+
+#endif
@@ -20,6 +20,8 @@
 #include "JavaClass.h"
 #include "JavaRef.h"
 
+#include "media/audio/InstrumentedAudioProcessing.h"
+
 #include "modules/audio_processing/include/audio_processing.h"
 
 #include <jni.h>
@@ -37,7 +39,7 @@ namespace jni
 				jfieldID stats;
 		};
 
-		void updateStats(const webrtc::AudioProcessingStats & stats, JNIEnv * env, const JavaRef<jobject> & javaType);
+		void updateStats(InstrumentedAudioProcessing * apm, JNIEnv * env, const JavaRef<jobject> & javaType);
 	}
 }
 
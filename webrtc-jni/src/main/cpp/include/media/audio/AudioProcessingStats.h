@@ -42,6 +42,22 @@ namespace jni
 				jfieldID delayStandardDeviationMs;
 				jfieldID residualEchoLikelihood;
 				jfieldID residualEchoLikelihoodRecentMax;
+				jfieldID captureFrames;
+				jfieldID captureFramesPerSecond;
+				jfieldID captureTimeMeanUs;
+				jfieldID captureTimeMaxUs;
+				jfieldID captureTimeHistogram;
+				jfieldID renderFrames;
+				jfieldID renderFramesPerSecond;
+				jfieldID renderTimeMeanUs;
+				jfieldID renderTimeMaxUs;
+				jfieldID renderTimeHistogram;
+				jfieldID echoCancellerEnabled;
+				jfieldID noiseSuppressionEnabled;
+				jfieldID gainControllerEnabled;
+				jfieldID gainControllerDigitalEnabled;
+				jfieldID highPassFilterEnabled;
+				jfieldID captureLevelAdjustmentEnabled;
 		};
 	}
 }
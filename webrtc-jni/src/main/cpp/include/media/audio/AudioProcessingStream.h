@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_PROCESSING_STREAM_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_PROCESSING_STREAM_H_
+
+#include "media/audio/AudioConverter.h"
+
+#include "modules/audio_processing/include/audio_processing.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace jni
+{
+	// Holds the pre-registered stream formats of an AudioProcessing instance
+	// and processes batches of consecutive 10 ms frames with them. This avoids
+	// converting the Java stream configs on every frame. The forward and
+	// reverse streams may be processed on different threads. Single frames
+	// with per-call formats may be processed concurrently, their remixing
+	// state is locked per direction.
+	//
+	// 16-bit frames may change between any channel layouts. Mono is
+	// duplicated into all output channels without gain, other layouts are
+	// remixed with the WebRTC channel mixing matrix, which supports up to
+	// kMaxRemixChannels channels. Remixing happens on the
+	// side with fewer channels, so that the APM processes as few channels as
+	// possible. Down-mixing to mono is left to the APM and its configured
+	// down-mix method. The caller's output is never used as scratch space.
+	//
+	// Float samples are passed to the float interface of the APM, which works
+	// in float internally. Planar batches store each 10 ms frame as one block
+	// of samples per channel, which is passed to the APM without copying.
+	class AudioProcessingStream
+	{
+		public:
+			static constexpr size_t kMaxRemixChannels = 8;
+
+			AudioProcessingStream();
+			~AudioProcessingStream() = default;
+
+			// Returns false if the formats would need a remix of more than
+			// kMaxRemixChannels channels.
+			static bool canRemix(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output);
+
+			bool setStreamConfig(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output);
+			bool setReverseStreamConfig(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output);
+
+			// Returns 0 if all frames were processed, otherwise the error code
+			// of the first frame that failed.
+			int processStream(webrtc::AudioProcessing * apm, const int16_t * src, int16_t * dst, size_t frames);
+			int processReverseStream(webrtc::AudioProcessing * apm, const int16_t * src, int16_t * dst, size_t frames);
+
+			int processStream(webrtc::AudioProcessing * apm, const float * src, float * dst, size_t frames, bool planar);
+			int processReverseStream(webrtc::AudioProcessing * apm, const float * src, float * dst, size_t frames, bool planar);
+
+			// Processes a single 16-bit frame with formats given per call. The
+			// remixing state is kept until the formats change. Returns
+			// kBadNumberChannelsError if the formats cannot be remixed.
+			int processFrame(webrtc::AudioProcessing * apm, const webrtc::StreamConfig & input,
+				const webrtc::StreamConfig & output, const int16_t * src, int16_t * dst, bool reverse);
+
+			// The sizes of one 10 ms frame in samples of all channels.
+			size_t getInputSamples(bool reverse) const;
+			size_t getOutputSamples(bool reverse) const;
+
+		private:
+			enum class Remix { kNone, kDuplicate, kBefore, kAfter };
+
+			struct Direction
+			{
+				// Only locked for single frames with per-call formats.
+				std::mutex mutex;
+				webrtc::StreamConfig input;
+				webrtc::StreamConfig output;
+				bool configured = false;
+				// How 16-bit frames are remixed and the formats passed to the
+				// APM for them.
+				Remix remix = Remix::kNone;
+				webrtc::StreamConfig processInput;
+				webrtc::StreamConfig processOutput;
+				std::unique_ptr<AudioConverter> mixer;
+				// Holds the remixed input or the processed output frame.
+				std::vector<int16_t> buffer;
+				// Hold the deinterleaved frames of the float interface.
+				std::vector<float> planarInput;
+				std::vector<float> planarOutput;
+				std::vector<const float *> srcChannels;
+				std::vector<float *> dstChannels;
+			};
+
+			static void configure(Direction & direction, const webrtc::StreamConfig & input,
+				const webrtc::StreamConfig & output);
+
+			int process(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+				const int16_t * src, int16_t * dst, size_t frames);
+			int process(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+				const float * src, float * dst, size_t frames, bool planar);
+			int processFrame(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+				const int16_t * src, int16_t * dst);
+
+		private:
+			Direction forward;
+			Direction backward;
+			// The per-call formats of single frames.
+			Direction forwardFrame;
+			Direction backwardFrame;
+	};
+}
+
+#endif
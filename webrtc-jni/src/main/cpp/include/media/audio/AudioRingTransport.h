@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_RING_TRANSPORT_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_RING_TRANSPORT_H_
+
+#include "media/audio/AudioCaptureRing.h"
+#include "media/audio/AudioPlaybackRing.h"
+
+#include "modules/audio_device/include/audio_device_defines.h"
+
+#include <atomic>
+
+namespace jni
+{
+	// The single audio callback of an audio device module, dispatching captured
+	// audio to the current capture ring and pulling playout audio from the
+	// current playback ring. Both rings can be set and cleared independently.
+	class AudioRingTransport : public webrtc::AudioTransport
+	{
+		public:
+			AudioRingTransport();
+			~AudioRingTransport() = default;
+
+			void setCaptureRing(AudioCaptureRing * ring);
+			void setPlaybackRing(AudioPlaybackRing * ring);
+
+			bool isEmpty() const;
+
+			int32_t RecordedDataIsAvailable(
+				const void * audioSamples,
+				const size_t nSamples,
+				const size_t nBytesPerSample,
+				const size_t nChannels,
+				const uint32_t samplesPerSec,
+				const uint32_t totalDelayMS,
+				const int32_t clockDrift,
+				const uint32_t currentMicLevel,
+				const bool keyPressed,
+				uint32_t & newMicLevel) override;
+
+			int32_t NeedMorePlayData(
+				const size_t nSamples,
+				const size_t nBytesPerSample,
+				const size_t nChannels,
+				const uint32_t samplesPerSec,
+				void * audioSamples,
+				size_t & nSamplesOut,
+				int64_t * elapsed_time_ms,
+				int64_t * ntp_time_ms) override;
+
+			void PullRenderData(
+				int bits_per_sample,
+				int sample_rate,
+				size_t number_of_channels,
+				size_t number_of_frames,
+				void * audio_data,
+				int64_t * elapsed_time_ms,
+				int64_t * ntp_time_ms) override;
+
+		private:
+			std::atomic<AudioCaptureRing *> captureRing;
+			std::atomic<AudioPlaybackRing *> playbackRing;
+	};
+}
+
+#endif
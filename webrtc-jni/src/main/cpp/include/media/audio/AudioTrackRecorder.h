@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_TRACK_RECORDER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_TRACK_RECORDER_H_
+
+#include "media/audio/AudioCaptureRing.h"
+
+#include "api/media_stream_interface.h"
+#include "common_audio/wav_file.h"
+#include "rtc_base/system/file_wrapper.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace jni
+{
+	// Records the audio of a track into a WAV or raw PCM file. The audio
+	// thread only copies each chunk into a lock-free ring; a process-wide
+	// writer thread, shared by all recorders, drains the rings in batches and
+	// performs the file I/O. The file format is taken from the first chunk
+	// received, later chunks with a different format are dropped.
+	class AudioTrackRecorder : public webrtc::AudioTrackSinkInterface
+	{
+		public:
+			enum class FileFormat { kWav, kRaw };
+
+			// Opens the file, throws jni::Exception if it cannot be created.
+			AudioTrackRecorder(const std::string & fileName, FileFormat format, size_t bufferSize);
+			// Writes pending audio and closes the file. Remove the recorder
+			// from the track before it is destroyed.
+			~AudioTrackRecorder();
+
+			// AudioTrackSinkInterface implementation.
+			void OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels,
+				size_t frames) override;
+
+			uint64_t getWrittenFrames() const;
+			uint64_t getDroppedCount() const;
+
+		private:
+			friend class AudioTrackRecorderWriter;
+
+			// Called on the writer thread only.
+			void drain();
+			void write(const uint8_t * data, size_t size);
+
+		private:
+			const FileFormat format;
+
+			AudioCaptureRing ring;
+
+			// Accessed by the audio thread only.
+			int streamSampleRate;
+			size_t streamChannels;
+
+			// Accessed by the writer thread, or after unregistering.
+			webrtc::FileWrapper file;
+			std::unique_ptr<webrtc::WavWriter> wavWriter;
+
+			std::atomic<uint64_t> writtenFrames;
+			std::atomic<uint64_t> droppedCount;
+	};
+}
+
+#endif
@@ -21,8 +21,11 @@
 #include "rtc_base/ref_counted_object.h"
 
 #include "media/SyncClock.h"
+#include "media/audio/AudioConverter.h"
+#include "media/audio/AudioPacer.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <atomic>
 
@@ -32,6 +35,7 @@ namespace jni
     {
         public:
             explicit CustomAudioSource(std::shared_ptr<SyncClock> clock);
+            ~CustomAudioSource() override;
 
             // AudioSourceInterface implementation
             void RegisterObserver(webrtc::ObserverInterface * observer) override;
@@ -41,20 +45,104 @@ namespace jni
             SourceState state() const override;
             bool remote() const override;
 
-            // Push audio data with synchronization
+            // Push audio data with synchronization. Formats other than 16-bit are
+            // converted to 16-bit if a target format or pacing is set.
             void PushAudioData(const void * audio_data, int bits_per_sample,
                               int sample_rate, size_t number_of_channels,
                               size_t number_of_frames);
 
+            // Push 16-bit audio data, converted to the target format if one is set
+            void PushAudioData(const int16_t * audio_data, int sample_rate,
+                              size_t number_of_channels, size_t number_of_frames);
+
+            // Push 32-bit float audio data in the range [-1, 1], converted to
+            // 16-bit and to the target format if one is set
+            void PushAudioData(const float * audio_data, int sample_rate,
+                              size_t number_of_channels, size_t number_of_frames);
+
+            // Set the format pushed audio is delivered in. A sample rate of zero
+            // disables resampling and remixing.
+            void SetTargetFormat(int sample_rate, size_t number_of_channels);
+
+            // Buffer pushed audio and deliver it in exact 10 ms frames at a steady
+            // cadence from a pacer thread. Pushed audio is converted to the given
+            // format, which also becomes the target format.
+            void StartPacing(int sample_rate, size_t number_of_channels, size_t buffer_frames);
+            void StopPacing();
+
+            // Returns false if pacing is not active
+            bool GetPacingStats(size_t & buffered_frames, uint64_t & underruns, uint64_t & overruns);
+
             // Set audio capture delay for synchronization adjustment
             void SetAudioCaptureDelay(int64_t delay_us);
 
         private:
-            std::vector<webrtc::AudioTrackSinkInterface*> sinks_;
+            // Passes the audio to all sinks
+            void DeliverAudioData(const void * audio_data, int bits_per_sample,
+                                 int sample_rate, size_t number_of_channels,
+                                 size_t number_of_frames);
+
+            void PushConvertedData(const int16_t * audio_data, int sample_rate,
+                                  size_t number_of_channels, size_t number_of_frames);
+
+            // Rechunks into 10 ms chunks of the input format, converts them and
+            // passes them on. Less than 10 ms is kept in pending_ for the next push.
+            void PushChunks(const int16_t * audio_data, int sample_rate,
+                           size_t number_of_channels, size_t number_of_frames);
+
+            // Converts one 10 ms chunk and passes it to the pacer or the sinks
+            void PushChunk(const int16_t * audio_data, int sample_rate,
+                          size_t number_of_channels, size_t number_of_frames);
+
+            // Converts into convert_buffer_ and returns the number of target frames
+            size_t ConvertData(const int16_t * audio_data, int sample_rate,
+                              size_t number_of_channels, size_t number_of_frames);
+
+        private:
+            using SinkList = std::vector<webrtc::AudioTrackSinkInterface*>;
+
+            void PublishSinks(const SinkList * sinks);
+
+            // Immutable snapshot of the registered sinks. The push path only
+            // loads the current snapshot without locking. AddSink and RemoveSink
+            // publish a modified copy and free the previous snapshot once no
+            // push is reading it anymore. Sinks must not be added or removed
+            // from within a sink callback.
+            std::atomic<const SinkList *> sinks_;
+            // Pushes count themselves in the reader slot of the current epoch.
+            // A writer advances the epoch before it waits for a slot, so new
+            // pushes use the other slot and cannot starve the writer.
+            std::atomic<unsigned> sink_epoch_;
+            std::atomic<int> sink_readers_[2];
+            std::mutex sinks_mutex_;
+
             std::shared_ptr<SyncClock> clock_;
-            //webrtc::CriticalSection crit_;
             std::atomic<int64_t> total_samples_captured_;
             int64_t audio_capture_delay_us_;
+
+            // Set while a target format or pacing is set. Pushes only take
+            // convert_mutex_ if set, so that plain pushes stay lock-free.
+            std::atomic<bool> processing_;
+
+            // Format conversion state, guarded by convert_mutex_
+            std::mutex convert_mutex_;
+            int target_sample_rate_;
+            size_t target_channels_;
+            std::unique_ptr<AudioConverter> converter_;
+            // The input format converter_ was created for
+            int converter_sample_rate_;
+            size_t converter_channels_;
+            size_t converter_frames_;
+            std::vector<int16_t> convert_buffer_;
+
+            // Pacing state, guarded by convert_mutex_
+            std::unique_ptr<AudioPacer> pacer_;
+            // Holds less than one 10 ms chunk, allocated once for the largest
+            // chunk a converter accepts
+            std::vector<int16_t> pending_;
+            size_t pending_samples_;
+            int pending_sample_rate_;
+            size_t pending_channels_;
     };
 }
 
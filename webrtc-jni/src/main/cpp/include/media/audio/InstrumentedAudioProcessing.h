@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_INSTRUMENTED_AUDIO_PROCESSING_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_INSTRUMENTED_AUDIO_PROCESSING_H_
+
+#include "api/scoped_refptr.h"
+#include "modules/audio_processing/include/audio_processing.h"
+#include "rtc_base/synchronization/mutex.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace jni
+{
+	// Forwards all calls to an AudioProcessing instance and measures the wall
+	// time of each ProcessStream and ProcessReverseStream call. Since the same
+	// instance is handed to the PeerConnectionFactory, this covers audio
+	// processed by WebRTC as well as audio processed through the Java API.
+	// The measurements are lock-free and may be read from any thread.
+	class InstrumentedAudioProcessing : public webrtc::AudioProcessing
+	{
+		public:
+			// Upper bounds of the histogram buckets in microseconds. The last
+			// bucket counts all longer calls.
+			static constexpr std::array<int64_t, 7> kBucketBounds = { 50, 100, 200, 500, 1000, 2000, 5000 };
+			static constexpr size_t kBucketCount = kBucketBounds.size() + 1;
+
+			struct Timing
+			{
+				uint64_t calls;
+				uint64_t totalMicros;
+				uint64_t maxMicros;
+				// Calls per second since the previous snapshot.
+				double callsPerSecond;
+				std::array<uint64_t, kBucketCount> histogram;
+			};
+
+			explicit InstrumentedAudioProcessing(webrtc::scoped_refptr<webrtc::AudioProcessing> apm);
+			~InstrumentedAudioProcessing() override = default;
+
+			// Reads the capture and render timings.
+			void getTimings(Timing & capture, Timing & render);
+
+			// AudioProcessing implementation.
+			int Initialize() override;
+			int Initialize(const webrtc::ProcessingConfig & processingConfig) override;
+			void ApplyConfig(const Config & config) override;
+			int proc_sample_rate_hz() const override;
+			int proc_split_sample_rate_hz() const override;
+			size_t num_input_channels() const override;
+			size_t num_proc_channels() const override;
+			size_t num_output_channels() const override;
+			size_t num_reverse_channels() const override;
+			void set_output_will_be_muted(bool muted) override;
+			void SetRuntimeSetting(RuntimeSetting setting) override;
+			bool PostRuntimeSetting(RuntimeSetting setting) override;
+			int ProcessStream(const int16_t * const src, const webrtc::StreamConfig & inputConfig,
+				const webrtc::StreamConfig & outputConfig, int16_t * const dest) override;
+			int ProcessStream(const float * const * src, const webrtc::StreamConfig & inputConfig,
+				const webrtc::StreamConfig & outputConfig, float * const * dest) override;
+			int ProcessReverseStream(const int16_t * const src, const webrtc::StreamConfig & inputConfig,
+				const webrtc::StreamConfig & outputConfig, int16_t * const dest) override;
+			int ProcessReverseStream(const float * const * src, const webrtc::StreamConfig & inputConfig,
+				const webrtc::StreamConfig & outputConfig, float * const * dest) override;
+			int AnalyzeReverseStream(const float * const * data, const webrtc::StreamConfig & reverseConfig) override;
+			bool GetLinearAecOutput(webrtc::ArrayView<std::array<float, 160>> linearOutput) const override;
+			void set_stream_analog_level(int level) override;
+			int recommended_stream_analog_level() const override;
+			int set_stream_delay_ms(int delay) override;
+			int stream_delay_ms() const override;
+			void set_stream_key_pressed(bool keyPressed) override;
+			bool CreateAndAttachAecDump(absl::string_view fileName, int64_t maxLogSizeBytes,
+				webrtc::TaskQueueBase * workerQueue) override;
+			bool CreateAndAttachAecDump(FILE * handle, int64_t maxLogSizeBytes,
+				webrtc::TaskQueueBase * workerQueue) override;
+			void AttachAecDump(std::unique_ptr<webrtc::AecDump> aecDump) override;
+			void DetachAecDump() override;
+			webrtc::AudioProcessingStats GetStatistics() override;
+			webrtc::AudioProcessingStats GetStatistics(bool hasRemoteTracks) override;
+			Config GetConfig() const override;
+
+		private:
+			struct Recorder
+			{
+				std::atomic<uint64_t> calls { 0 };
+				std::atomic<uint64_t> totalMicros { 0 };
+				std::atomic<uint64_t> maxMicros { 0 };
+				std::array<std::atomic<uint64_t>, kBucketCount> histogram {};
+
+				// The call count of the previous snapshot.
+				uint64_t lastCalls = 0;
+
+				void record(std::chrono::steady_clock::time_point start);
+				void read(Timing & timing, double elapsedSeconds);
+			};
+
+		private:
+			const webrtc::scoped_refptr<webrtc::AudioProcessing> apm;
+
+			Recorder capture;
+			Recorder render;
+
+			webrtc::Mutex snapshotMutex;
+			std::chrono::steady_clock::time_point lastSnapshot;
+	};
+}
+
+#endif
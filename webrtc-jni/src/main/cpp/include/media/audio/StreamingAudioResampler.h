@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_STREAMING_AUDIO_RESAMPLER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_STREAMING_AUDIO_RESAMPLER_H_
+
+#include "common_audio/resampler/push_sinc_resampler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace jni
+{
+	// Resamples interleaved audio of any chunk size. Input is collected into
+	// fixed blocks of about 10 ms, which are resampled per channel with the
+	// filter state kept across calls. Output that does not fit into the
+	// caller's buffer is kept and returned by the next call.
+	class StreamingAudioResampler
+	{
+		public:
+			StreamingAudioResampler(int srcSampleRate, int dstSampleRate, size_t channels);
+			~StreamingAudioResampler() = default;
+
+			// Consumes all input frames and writes up to 'dstCapacity' frames.
+			// Returns the number of frames written.
+			size_t resample(const int16_t * src, size_t srcFrames, int16_t * dst, size_t dstCapacity);
+			size_t resample(const float * src, size_t srcFrames, float * dst, size_t dstCapacity);
+
+			size_t getChannels() const;
+
+			// The number of resampled frames waiting to be read.
+			size_t getAvailableFrames() const;
+
+			// Drops pending input and output and clears the filter state.
+			void reset();
+
+		private:
+			template <typename T>
+			void write(const T * src, size_t frames);
+
+			template <typename T>
+			size_t read(T * dst, size_t capacity);
+
+			void processBlock();
+
+		private:
+			const size_t channels;
+			const size_t srcBlockFrames;
+			const size_t dstBlockFrames;
+
+			// Planar input block and the number of frames it holds.
+			std::vector<float> srcBlock;
+			size_t srcBlockFill;
+
+			std::vector<float> dstBlock;
+
+			// Interleaved output, valid from 'outputStart' to the end.
+			std::vector<float> output;
+			size_t outputStart;
+
+			// One resampler per channel. Empty if the rate does not change.
+			std::vector<std::unique_ptr<webrtc::PushSincResampler>> resamplers;
+	};
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_WEBRTC_MEDIA_AUDIO_VOICE_ACTIVITY_SEGMENTER_H_
+#define JNI_WEBRTC_MEDIA_AUDIO_VOICE_ACTIVITY_SEGMENTER_H_
+
+#include "modules/audio_processing/vad/voice_activity_detector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace jni
+{
+	// Splits mono 16-bit audio into speech segments. The audio is analyzed in
+	// 10 ms frames. Short pauses within speech are bridged by a hangover time
+	// and speech shorter than a minimum duration is discarded. All offsets are
+	// given in samples since the first processed sample.
+	class VoiceActivitySegmenter
+	{
+		public:
+			struct Params
+			{
+				float threshold;
+				int minSpeechMillis;
+				int hangoverMillis;
+			};
+
+			// A confirmed speech start has a negative end offset.
+			struct Event
+			{
+				int64_t start;
+				int64_t end;
+			};
+
+		public:
+			VoiceActivitySegmenter(int sampleRate, const Params & params);
+			~VoiceActivitySegmenter() = default;
+
+			// Analyzes the samples and appends the resulting events. Samples
+			// that do not fill a 10 ms frame are kept for the next call.
+			void process(const int16_t * samples, size_t count, std::vector<Event> & events);
+
+			// Closes an open speech segment.
+			void flush(std::vector<Event> & events);
+
+			// Advances by one 10 ms frame with the given voice probability
+			// instead of analyzing audio.
+			void processProbability(float probability, std::vector<Event> & events);
+
+		private:
+			void processFrame(const int16_t * frame, std::vector<Event> & events);
+
+		private:
+			webrtc::VoiceActivityDetector detector;
+
+			const int sampleRate;
+			const size_t frameSize;
+			const float threshold;
+			const int64_t minSpeechSamples;
+			const int64_t hangoverSamples;
+
+			std::vector<int16_t> frame;
+			size_t frameFill;
+
+			int64_t position;
+			int64_t speechStart;
+			int64_t speechEnd;
+			bool inSpeech;
+			bool confirmed;
+	};
+}
+
+#endif
@@ -37,7 +37,7 @@ namespace jni
 	class WavAudioFileSink : public AudioSink
 	{
 		public:
-			WavAudioFileSink(std::string fileName);
+			WavAudioFileSink(std::string fileName, int sampleRate = 48000, size_t channels = 2);
 			~WavAudioFileSink();
 
 			int32_t RecordedDataIsAvailable(
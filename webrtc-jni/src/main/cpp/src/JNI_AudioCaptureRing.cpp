@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_AudioCaptureRing.h"
+#include "JavaError.h"
+#include "JavaUtils.h"
+#include "media/audio/AudioCaptureRing.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLE(ring);
+
+	delete ring;
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_initialize
+(JNIEnv * env, jobject caller, jint capacity)
+{
+	jni::AudioCaptureRing * ring = new jni::AudioCaptureRing(static_cast<size_t>(capacity));
+
+	SetHandle(env, caller, ring);
+}
+
+JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_createBuffer
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, nullptr);
+
+	return env->NewDirectByteBuffer(ring->data(), static_cast<jlong>(ring->getCapacity()));
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getWritePosition
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getWritePosition());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getReadPosition
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getReadPosition());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_setReadPosition
+(JNIEnv * env, jobject caller, jlong position)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLE(ring);
+
+	const uint64_t read = ring->getReadPosition();
+	const uint64_t write = ring->getWritePosition();
+	const uint64_t target = static_cast<uint64_t>(position);
+
+	if (position < 0 || target < read || target > write) {
+		env->Throw(jni::JavaError(env, "Read position out of range"));
+		return;
+	}
+
+	ring->setReadPosition(target);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getOverrunCount
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getOverrunCount());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getSampleRate
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jint>(ring->getSampleRate());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getChannels
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jint>(ring->getChannels());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioCaptureRing_getBytesPerSample
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jint>(ring->getBytesPerSample());
+}
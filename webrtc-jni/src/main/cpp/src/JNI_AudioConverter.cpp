@@ -17,8 +17,11 @@
 #include "JNI_AudioConverter.h"
 #include "api/audio/audio_processing.h"
 #include "media/audio/AudioConverter.h"
+#include "JavaError.h"
 #include "JavaUtils.h"
 
+#include <type_traits>
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertInternal
 (JNIEnv * env, jobject caller, jbyteArray src, jint nSrcSamples, jbyteArray dst, jint nDstSamples)
 {
@@ -42,6 +45,50 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convert
 	env->ReleaseByteArrayElements(dst, dstPtr, JNI_ABORT);
 }
 
+template <typename T>
+static void convertDirect(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dst, jint dstOffset)
+{
+	jni::AudioConverter * converter = GetHandle<jni::AudioConverter>(env, caller);
+	CHECK_HANDLE(converter);
+
+	uint8_t * srcAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(src));
+	uint8_t * dstAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(dst));
+
+	if (srcAddress == nullptr || dstAddress == nullptr) {
+		env->Throw(jni::JavaError(env, "Audio buffers must be direct buffers"));
+		return;
+	}
+
+	// Offsets and capacities are given in buffer elements, bytes for a
+	// ByteBuffer and floats for a FloatBuffer.
+	const size_t elementSize = std::is_same_v<T, float> ? sizeof(float) : 1;
+	const size_t srcSize = converter->getSrcFrames() * converter->getSrcChannels();
+	const size_t dstSize = converter->getDstFrames() * converter->getDstChannels();
+	const size_t srcCapacity = static_cast<size_t>(env->GetDirectBufferCapacity(src)) * elementSize;
+	const size_t dstCapacity = static_cast<size_t>(env->GetDirectBufferCapacity(dst)) * elementSize;
+
+	if (static_cast<size_t>(srcOffset) * elementSize + srcSize * sizeof(T) > srcCapacity ||
+		static_cast<size_t>(dstOffset) * elementSize + dstSize * sizeof(T) > dstCapacity) {
+		env->Throw(jni::JavaError(env, "Audio buffer too small for a 10 ms frame"));
+		return;
+	}
+
+	converter->convert(reinterpret_cast<const T *>(srcAddress + srcOffset * elementSize), srcSize,
+		reinterpret_cast<T *>(dstAddress + dstOffset * elementSize), dstSize);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dst, jint dstOffset)
+{
+	convertDirect<int16_t>(env, caller, src, srcOffset, dst, dstOffset);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_convertFloatDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dst, jint dstOffset)
+{
+	convertDirect<float>(env, caller, src, srcOffset, dst, dstOffset);
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioConverter_dispose
 (JNIEnv * env, jobject caller)
 {
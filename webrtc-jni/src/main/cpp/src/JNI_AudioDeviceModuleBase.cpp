@@ -25,7 +25,10 @@
 #include "JavaUtils.h"
 #include "WebRTCContext.h"
 #include "api/audio/create_audio_device_module.h"
+#include "media/audio/AudioCaptureRing.h"
 #include "media/audio/AudioDevice.h"
+#include "media/audio/AudioPlaybackRing.h"
+#include "media/audio/AudioRingTransport.h"
 #include "media/audio/AudioTransportSink.h"
 #include "media/audio/AudioTransportSource.h"
 
@@ -451,6 +454,99 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_
 	}
 }
 
+static jni::AudioRingTransport * getRingTransport(JNIEnv * env, jobject caller)
+{
+	jni::AudioRingTransport * transport = GetHandle<jni::AudioRingTransport>(env, caller, "ringTransportHandle");
+
+	if (transport == nullptr) {
+		transport = new jni::AudioRingTransport();
+
+		SetHandle(env, caller, "ringTransportHandle", transport);
+	}
+
+	return transport;
+}
+
+static void releaseRingTransport(JNIEnv * env, jobject caller, webrtc::AudioDeviceModule * audioModule)
+{
+	jni::AudioRingTransport * transport = GetHandle<jni::AudioRingTransport>(env, caller, "ringTransportHandle");
+
+	// Keep the transport registered while the other ring is still in use.
+	if (transport != nullptr && transport->isEmpty()) {
+		audioModule->RegisterAudioCallback(nullptr);
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_addCaptureRingInternal
+(JNIEnv * env, jobject caller, jobject jRing)
+{
+	if (jRing == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "AudioCaptureRing must not be null"));
+		return;
+	}
+
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	jni::AudioCaptureRing * ring = GetHandle<jni::AudioCaptureRing>(env, jRing);
+	CHECK_HANDLE(ring);
+
+	jni::AudioRingTransport * transport = getRingTransport(env, caller);
+	transport->setCaptureRing(ring);
+
+	audioModule->RegisterAudioCallback(transport);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_removeCaptureRingInternal
+(JNIEnv * env, jobject caller)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	jni::AudioRingTransport * transport = GetHandle<jni::AudioRingTransport>(env, caller, "ringTransportHandle");
+
+	if (transport != nullptr) {
+		transport->setCaptureRing(nullptr);
+	}
+
+	releaseRingTransport(env, caller, audioModule);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_addPlaybackRingInternal
+(JNIEnv * env, jobject caller, jobject jRing)
+{
+	if (jRing == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "AudioPlaybackRing must not be null"));
+		return;
+	}
+
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, jRing);
+	CHECK_HANDLE(ring);
+
+	jni::AudioRingTransport * transport = getRingTransport(env, caller);
+	transport->setPlaybackRing(ring);
+
+	audioModule->RegisterAudioCallback(transport);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_removePlaybackRingInternal
+(JNIEnv * env, jobject caller)
+{
+	webrtc::AudioDeviceModule * audioModule = GetHandle<webrtc::AudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	jni::AudioRingTransport * transport = GetHandle<jni::AudioRingTransport>(env, caller, "ringTransportHandle");
+
+	if (transport != nullptr) {
+		transport->setPlaybackRing(nullptr);
+	}
+
+	releaseRingTransport(env, caller, audioModule);
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_disposeInternal
 (JNIEnv * env, jobject caller)
 {
@@ -461,6 +557,10 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioDeviceModuleBase_
 		audioModule->Terminate();
 	}
 
+	delete GetHandle<jni::AudioRingTransport>(env, caller, "ringTransportHandle");
+
+	SetHandle<std::nullptr_t>(env, caller, "ringTransportHandle", nullptr);
+
 	webrtc::RefCountReleaseStatus status = audioModule->Release();
 
 	if (status != webrtc::RefCountReleaseStatus::kDroppedLastRef) {
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_AudioFileProcessor.h"
+#include "JavaRef.h"
+#include "JavaString.h"
+#include "JavaUtils.h"
+#include "WebRTCContext.h"
+
+#include "media/audio/AudioFileProcessor.h"
+#include "media/audio/AudioProcessingConfig.h"
+
+#include <string>
+#include <vector>
+
+static std::vector<std::string> toFileNames(JNIEnv * env, jobjectArray jFileNames)
+{
+	const jsize count = env->GetArrayLength(jFileNames);
+
+	std::vector<std::string> fileNames;
+	fileNames.reserve(static_cast<size_t>(count));
+
+	for (jsize i = 0; i < count; i++) {
+		jni::JavaLocalRef<jstring> fileName(env, static_cast<jstring>(env->GetObjectArrayElement(jFileNames, i)));
+
+		fileNames.push_back(jni::JavaString::toNative(env, fileName));
+	}
+
+	return fileNames;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_await
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLE(processor);
+
+	processor->wait();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_cancel
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLE(processor);
+
+	processor->cancel();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLE(processor);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete processor;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_initialize
+(JNIEnv * env, jobject caller, jobject jConfig, jint workerCount)
+{
+	jni::WebRTCContext * context = static_cast<jni::WebRTCContext *>(javaContext);
+
+	webrtc::AudioProcessing::Config config = jni::AudioProcessingConfig::toNative(env, jni::JavaLocalRef<jobject>(env, jConfig));
+
+	jni::AudioFileProcessor * processor = new jni::AudioFileProcessor(context->webrtcEnv, config,
+		static_cast<size_t>(workerCount));
+
+	SetHandle(env, caller, processor);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_startInternal
+(JNIEnv * env, jobject caller, jobjectArray jInputFiles, jobjectArray jOutputFiles)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLE(processor);
+
+	try {
+		processor->start(toFileNames(env, jInputFiles), toFileNames(env, jOutputFiles));
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getProgressInternal
+(JNIEnv * env, jobject caller, jfloatArray jProgress)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLE(processor);
+
+	std::vector<jfloat> progress(processor->getFileCount());
+
+	for (size_t i = 0; i < progress.size(); i++) {
+		progress[i] = processor->getProgress(i);
+	}
+
+	env->SetFloatArrayRegion(jProgress, 0, static_cast<jsize>(progress.size()), progress.data());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getStatusInternal
+(JNIEnv * env, jobject caller, jint index)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLEV(processor, 0);
+
+	return static_cast<jint>(processor->getStatus(static_cast<size_t>(index)));
+}
+
+JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_media_audio_AudioFileProcessor_getErrorInternal
+(JNIEnv * env, jobject caller, jint index)
+{
+	jni::AudioFileProcessor * processor = GetHandle<jni::AudioFileProcessor>(env, caller);
+	CHECK_HANDLEV(processor, nullptr);
+
+	std::string error = processor->getError(static_cast<size_t>(index));
+
+	if (error.empty()) {
+		return nullptr;
+	}
+
+	return jni::JavaString::toJava(env, error).release();
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_AudioPlaybackRing.h"
+#include "JavaError.h"
+#include "JavaUtils.h"
+#include "media/audio/AudioPlaybackRing.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLE(ring);
+
+	delete ring;
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_initialize
+(JNIEnv * env, jobject caller, jint capacity, jint prefill)
+{
+	jni::AudioPlaybackRing * ring = new jni::AudioPlaybackRing(static_cast<size_t>(capacity), static_cast<size_t>(prefill));
+
+	SetHandle(env, caller, ring);
+}
+
+JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_createBuffer
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, nullptr);
+
+	return env->NewDirectByteBuffer(ring->data(), static_cast<jlong>(ring->getCapacity()));
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getWritePosition
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getWritePosition());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_setWritePosition
+(JNIEnv * env, jobject caller, jlong position)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLE(ring);
+
+	const uint64_t read = ring->getReadPosition();
+	const uint64_t write = ring->getWritePosition();
+	const uint64_t target = static_cast<uint64_t>(position);
+
+	if (position < 0 || target < write || target - read > ring->getCapacity()) {
+		env->Throw(jni::JavaError(env, "Write position out of range"));
+		return;
+	}
+
+	ring->setWritePosition(target);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getReadPosition
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getReadPosition());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getUnderrunCount
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jlong>(ring->getUnderrunCount());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getSampleRate
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jint>(ring->getSampleRate());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioPlaybackRing_getChannels
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioPlaybackRing * ring = GetHandle<jni::AudioPlaybackRing>(env, caller);
+	CHECK_HANDLEV(ring, 0);
+
+	return static_cast<jint>(ring->getChannels());
+}
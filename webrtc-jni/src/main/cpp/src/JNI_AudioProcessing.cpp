@@ -27,10 +27,12 @@
 
 #include "media/audio/AudioProcessing.h"
 #include "media/audio/AudioProcessingConfig.h"
+#include "media/audio/AudioProcessingStream.h"
 #include "media/audio/AudioProcessingStreamConfig.h"
-#include "api/audio/audio_frame.h"
+#include "media/audio/InstrumentedAudioProcessing.h"
 #include "api/audio/audio_processing.h"
 #include "api/audio/builtin_audio_processing_builder.h"
+#include "api/make_ref_counted.h"
 #include "api/scoped_refptr.h"
 #include "modules/audio_processing/include/audio_processing.h"
 #include "rtc_base/logging.h"
@@ -62,56 +64,39 @@ JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_getStr
 	return apm->stream_delay_ms();
 }
 
-JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStream
-(JNIEnv * env, jobject caller, jbyteArray src, jobject inputConfig, jobject outputConfig, jbyteArray dest)
+static jint processStreamArray(JNIEnv * env, jobject caller, jbyteArray src, jobject inputConfig,
+	jobject outputConfig, jbyteArray dest, bool reverse)
 {
 	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
 	CHECK_HANDLEV(apm, 0);
 
+	jni::AudioProcessingStream * stream = GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+	CHECK_HANDLEV(stream, 0);
+
 	webrtc::StreamConfig srcConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig));
 	webrtc::StreamConfig dstConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig));
 
+	const size_t srcSize = srcConfig.num_samples() * sizeof(int16_t);
+	const size_t dstSize = dstConfig.num_samples() * sizeof(int16_t);
+
+	if (srcSize > static_cast<size_t>(env->GetArrayLength(src)) ||
+		dstSize > static_cast<size_t>(env->GetArrayLength(dest))) {
+		return webrtc::AudioProcessing::kBadDataLengthError;
+	}
+
 	jboolean isDstCopy = JNI_FALSE;
 
-	jbyte * srcPtr = env->GetByteArrayElements(src, NULL);
+	jbyte * srcPtr = env->GetByteArrayElements(src, nullptr);
 	jbyte * dstPtr = env->GetByteArrayElements(dest, &isDstCopy);
 
 	const int16_t * srcFrame = reinterpret_cast<const int16_t *>(srcPtr);
 	int16_t * dstFrame = reinterpret_cast<int16_t *>(dstPtr);
 
-	int result;
-
-	if (srcConfig.num_channels() == 1 && dstConfig.num_channels() == 2) {
-		// Up-mixing, only mono to stereo.
-		// For complex channel layouts a channel mixer is required.
-
-		const size_t srcNumSamples = srcConfig.num_samples();
-		const size_t dstNumChannels = dstConfig.num_channels();
-		const size_t frameSize = srcNumSamples * dstNumChannels;
-
-		if (frameSize > webrtc::AudioFrame::kMaxDataSizeSamples) {
-			return -9;
-		}
-
-		for (int i = static_cast<int>(srcNumSamples) - 1; i >= 0; i--) {
-			for (size_t j = 0; j < dstNumChannels; ++j) {
-				dstFrame[dstNumChannels * i + j] = srcFrame[i];
-			}
-		}
-
-		srcConfig.set_num_channels(dstNumChannels);
-
-		result = apm->ProcessStream(dstFrame, srcConfig, dstConfig, dstFrame);
-	}
-	else {
-		// Will also down-mix if required, e.g. from stereo to mono.
-		result = apm->ProcessStream(srcFrame, srcConfig, dstConfig, dstFrame);
-	}
+	// Any channel layout change is remixed natively, see AudioProcessingStream.
+	int result = stream->processFrame(apm, srcConfig, dstConfig, srcFrame, dstFrame, reverse);
 
 	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(dest);
-
-		env->SetByteArrayRegion(dest, 0, dstLength, dstPtr);
+		env->SetByteArrayRegion(dest, 0, static_cast<jsize>(dstSize), dstPtr);
 	}
 
 	env->ReleaseByteArrayElements(src, srcPtr, JNI_ABORT);
@@ -120,62 +105,138 @@ JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_proces
 	return result;
 }
 
-JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStream
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamArray
 (JNIEnv * env, jobject caller, jbyteArray src, jobject inputConfig, jobject outputConfig, jbyteArray dest)
+{
+	return processStreamArray(env, caller, src, inputConfig, outputConfig, dest, false);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamArray
+(JNIEnv * env, jobject caller, jbyteArray src, jobject inputConfig, jobject outputConfig, jbyteArray dest)
+{
+	return processStreamArray(env, caller, src, inputConfig, outputConfig, dest, true);
+}
+
+static jint processStreamDirect(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest,
+	jint destOffset, jint frames, bool reverse)
 {
 	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
 	CHECK_HANDLEV(apm, 0);
 
-	webrtc::StreamConfig srcConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig));
-	webrtc::StreamConfig dstConfig = jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig));
+	jni::AudioProcessingStream * stream = GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+	CHECK_HANDLEV(stream, 0);
 
-	jboolean isDstCopy = JNI_FALSE;
+	uint8_t * srcAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(src));
+	uint8_t * dstAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(dest));
 
-	jbyte * srcPtr = env->GetByteArrayElements(src, nullptr);
-	jbyte * dstPtr = env->GetByteArrayElements(dest, &isDstCopy);
+	if (srcAddress == nullptr || dstAddress == nullptr) {
+		env->Throw(jni::JavaError(env, "Audio buffers must be direct buffers"));
+		return 0;
+	}
 
-	const int16_t * srcFrame = reinterpret_cast<const int16_t *>(srcPtr);
-	int16_t * dstFrame = reinterpret_cast<int16_t *>(dstPtr);
+	const size_t count = static_cast<size_t>(frames);
+	const size_t srcSize = static_cast<size_t>(srcOffset) + count * stream->getInputSamples(reverse) * sizeof(int16_t);
+	const size_t dstSize = static_cast<size_t>(destOffset) + count * stream->getOutputSamples(reverse) * sizeof(int16_t);
 
-	int result;
+	if (srcSize > static_cast<size_t>(env->GetDirectBufferCapacity(src)) ||
+		dstSize > static_cast<size_t>(env->GetDirectBufferCapacity(dest))) {
+		env->Throw(jni::JavaError(env, "Audio buffer too small for %d frames", frames));
+		return 0;
+	}
 
-	if (srcConfig.num_channels() == 1 && dstConfig.num_channels() == 2) {
-		// Up-mixing, only mono to stereo.
-		// For complex channel layouts a channel mixer is required.
+	const int16_t * srcFrames = reinterpret_cast<const int16_t *>(srcAddress + srcOffset);
+	int16_t * dstFrames = reinterpret_cast<int16_t *>(dstAddress + destOffset);
 
-		const size_t srcNumSamples = srcConfig.num_samples();
-		const size_t dstNumChannels = dstConfig.num_channels();
-		const size_t frameSize = srcNumSamples * dstNumChannels;
+	return reverse
+		? stream->processReverseStream(apm, srcFrames, dstFrames, count)
+		: stream->processStream(apm, srcFrames, dstFrames, count);
+}
 
-		if (frameSize > webrtc::AudioFrame::kMaxDataSizeSamples) {
-			return -9;
-		}
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest, jint destOffset, jint frames)
+{
+	return processStreamDirect(env, caller, src, srcOffset, dest, destOffset, frames, false);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest, jint destOffset, jint frames)
+{
+	return processStreamDirect(env, caller, src, srcOffset, dest, destOffset, frames, true);
+}
+
+static jint processStreamFloat(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest,
+	jint destOffset, jint frames, jboolean planar, bool reverse)
+{
+	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
+	CHECK_HANDLEV(apm, 0);
 
-		for (int i = static_cast<int>(srcNumSamples) - 1; i >= 0; i--) {
-			for (size_t j = 0; j < dstNumChannels; ++j) {
-				dstFrame[dstNumChannels * i + j] = srcFrame[i];
-			}
-		}
+	jni::AudioProcessingStream * stream = GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+	CHECK_HANDLEV(stream, 0);
 
-		srcConfig.set_num_channels(dstNumChannels);
+	float * srcAddress = static_cast<float *>(env->GetDirectBufferAddress(src));
+	float * dstAddress = static_cast<float *>(env->GetDirectBufferAddress(dest));
 
-		result = apm->ProcessReverseStream(dstFrame, srcConfig, dstConfig, dstFrame);
+	if (srcAddress == nullptr || dstAddress == nullptr) {
+		env->Throw(jni::JavaError(env, "Audio buffers must be direct buffers"));
+		return 0;
 	}
-	else {
-		// Will also down-mix if required, e.g. from stereo to mono.
-		result = apm->ProcessReverseStream(srcFrame, srcConfig, dstConfig, dstFrame);
+
+	// The capacity of a FloatBuffer is given in floats.
+	const size_t count = static_cast<size_t>(frames);
+	const size_t srcSize = static_cast<size_t>(srcOffset) + count * stream->getInputSamples(reverse);
+	const size_t dstSize = static_cast<size_t>(destOffset) + count * stream->getOutputSamples(reverse);
+
+	if (srcSize > static_cast<size_t>(env->GetDirectBufferCapacity(src)) ||
+		dstSize > static_cast<size_t>(env->GetDirectBufferCapacity(dest))) {
+		env->Throw(jni::JavaError(env, "Audio buffer too small for %d frames", frames));
+		return 0;
 	}
 
-	if (isDstCopy == JNI_TRUE) {
-		jsize dstLength = env->GetArrayLength(dest);
+	return reverse
+		? stream->processReverseStream(apm, srcAddress + srcOffset, dstAddress + destOffset, count, planar == JNI_TRUE)
+		: stream->processStream(apm, srcAddress + srcOffset, dstAddress + destOffset, count, planar == JNI_TRUE);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processStreamFloat
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest, jint destOffset, jint frames, jboolean planar)
+{
+	return processStreamFloat(env, caller, src, srcOffset, dest, destOffset, frames, planar, false);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_processReverseStreamFloat
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jobject dest, jint destOffset, jint frames, jboolean planar)
+{
+	return processStreamFloat(env, caller, src, srcOffset, dest, destOffset, frames, planar, true);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_setStreamConfigInternal
+(JNIEnv * env, jobject caller, jobject inputConfig, jobject outputConfig)
+{
+	jni::AudioProcessingStream * stream = GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+	CHECK_HANDLE(stream);
 
-		env->SetByteArrayRegion(dest, 0, dstLength, dstPtr);
+	bool configured = stream->setStreamConfig(
+		jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig)),
+		jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig)));
+
+	if (!configured) {
+		env->Throw(jni::JavaError(env, "Cannot remix more than %zu channels", jni::AudioProcessingStream::kMaxRemixChannels));
 	}
+}
 
-	env->ReleaseByteArrayElements(src, srcPtr, JNI_ABORT);
-	env->ReleaseByteArrayElements(dest, dstPtr, JNI_ABORT);
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_setReverseStreamConfigInternal
+(JNIEnv * env, jobject caller, jobject inputConfig, jobject outputConfig)
+{
+	jni::AudioProcessingStream * stream = GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+	CHECK_HANDLE(stream);
 
-	return result;
+	bool configured = stream->setReverseStreamConfig(
+		jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, inputConfig)),
+		jni::AudioProcessingStreamConfig::toNative(env, jni::JavaLocalRef<jobject>(env, outputConfig)));
+
+	if (!configured) {
+		env->Throw(jni::JavaError(env, "Cannot remix more than %zu channels", jni::AudioProcessingStream::kMaxRemixChannels));
+	}
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_dispose
@@ -184,6 +245,10 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_dispos
 	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
 	CHECK_HANDLE(apm);
 
+	delete GetHandle<jni::AudioProcessingStream>(env, caller, "streamHandle");
+
+	SetHandle<std::nullptr_t>(env, caller, "streamHandle", nullptr);
+
 	webrtc::RefCountReleaseStatus status = apm->Release();
 
 	if (status != webrtc::RefCountReleaseStatus::kDroppedLastRef) {
@@ -207,7 +272,12 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_initia
 		return;
 	}
 
-	SetHandle(env, caller, apm.release());
+	// Measures the processing time of all calls, including those made by a
+	// PeerConnectionFactory that uses this instance.
+	webrtc::scoped_refptr<webrtc::AudioProcessing> instrumented = webrtc::make_ref_counted<jni::InstrumentedAudioProcessing>(apm);
+
+	SetHandle(env, caller, instrumented.release());
+	SetHandle(env, caller, "streamHandle", new jni::AudioProcessingStream());
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_updateStats
@@ -216,5 +286,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioProcessing_update
 	webrtc::AudioProcessing * apm = GetHandle<webrtc::AudioProcessing>(env, caller);
 	CHECK_HANDLE(apm);
 
-	jni::AudioProcessing::updateStats(apm->GetStatistics(), env, jni::JavaLocalRef<jobject>(env, caller));
+	// The handle is always created as an instrumented instance.
+	auto instrumented = static_cast<jni::InstrumentedAudioProcessing *>(apm);
+
+	jni::AudioProcessing::updateStats(instrumented, env, jni::JavaLocalRef<jobject>(env, caller));
 }
\ No newline at end of file
@@ -15,12 +15,18 @@
  */
 
 #include "JNI_AudioTrack.h"
+#include "api/AudioTrackDirectSink.h"
 #include "api/AudioTrackSink.h"
+#include "media/audio/AudioLevelMeter.h"
+#include "media/audio/AudioTrackRecorder.h"
 #include "JavaNullPointerException.h"
+#include "JavaRef.h"
 #include "JavaUtils.h"
 
 #include "api/media_stream_interface.h"
 
+#include <vector>
+
 JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addSinkInternal
 (JNIEnv * env, jobject caller, jobject jsink)
 {
@@ -54,6 +60,129 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeSinkI
 	}
 }
 
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addDirectSinkInternal
+(JNIEnv * env, jobject caller, jobject jsink)
+{
+	if (jsink == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "AudioTrackDirectSink must not be null"));
+		return 0;
+	}
+
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLEV(track, 0);
+
+	auto sink = new jni::AudioTrackDirectSink(env, jni::JavaGlobalRef<jobject>(env, jsink));
+
+	track->AddSink(sink);
+
+	return reinterpret_cast<jlong>(sink);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeDirectSinkInternal
+(JNIEnv * env, jobject caller, jlong sinkHandle)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLE(track);
+
+	auto sink = reinterpret_cast<jni::AudioTrackDirectSink *>(sinkHandle);
+
+	if (sink != nullptr) {
+		track->RemoveSink(sink);
+
+		delete sink;
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addRecorderInternal
+(JNIEnv * env, jobject caller, jobject jrecorder)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLE(track);
+
+	jni::AudioTrackRecorder * recorder = GetHandle<jni::AudioTrackRecorder>(env, jrecorder);
+	CHECK_HANDLE(recorder);
+
+	track->AddSink(recorder);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeRecorderInternal
+(JNIEnv * env, jobject caller, jobject jrecorder)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLE(track);
+
+	jni::AudioTrackRecorder * recorder = GetHandle<jni::AudioTrackRecorder>(env, jrecorder);
+	CHECK_HANDLE(recorder);
+
+	track->RemoveSink(recorder);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_addLevelMeterInternal
+(JNIEnv * env, jobject caller)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLEV(track, 0);
+
+	auto meter = new jni::AudioLevelMeter();
+
+	track->AddSink(meter);
+
+	return reinterpret_cast<jlong>(meter);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_removeLevelMeterInternal
+(JNIEnv * env, jobject caller, jlong meterHandle)
+{
+	webrtc::AudioTrackInterface * track = GetHandle<webrtc::AudioTrackInterface>(env, caller);
+	CHECK_HANDLE(track);
+
+	auto meter = reinterpret_cast<jni::AudioLevelMeter *>(meterHandle);
+
+	if (meter != nullptr) {
+		track->RemoveSink(meter);
+
+		delete meter;
+	}
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_pollLevelsInternal
+(JNIEnv * env, jclass caller, jobjectArray jtracks, jfloatArray jlevels)
+{
+	const jsize count = env->GetArrayLength(jtracks);
+	jfieldID meterField = nullptr;
+
+	std::vector<jfloat> levels(static_cast<size_t>(count) * 3);
+
+	for (jsize i = 0; i < count; ++i) {
+		jni::JavaLocalRef<jobject> track(env, env->GetObjectArrayElement(jtracks, i));
+		jni::AudioLevelMeter * meter = nullptr;
+
+		if (track.get() != nullptr) {
+			if (meterField == nullptr) {
+				meterField = GetHandleField(env, track.get(), "levelMeterHandle");
+			}
+
+			meter = reinterpret_cast<jni::AudioLevelMeter *>(env->GetLongField(track.get(), meterField));
+		}
+
+		jfloat * out = levels.data() + i * 3;
+
+		if (meter != nullptr) {
+			out[0] = meter->getRms();
+			out[1] = meter->takePeak();
+			out[2] = meter->getLoudness();
+		}
+		else {
+			// Reported as silence.
+			out[0] = 0;
+			out[1] = 0;
+			out[2] = -100;
+		}
+	}
+
+	env->SetFloatArrayRegion(jlevels, 0, static_cast<jsize>(levels.size()), levels.data());
+}
+
 JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrack_getSignalLevel
 (JNIEnv * env, jobject caller)
 {
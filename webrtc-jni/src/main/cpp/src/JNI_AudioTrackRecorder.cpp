@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_AudioTrackRecorder.h"
+#include "JavaRef.h"
+#include "JavaString.h"
+#include "JavaUtils.h"
+#include "media/audio/AudioTrackRecorder.h"
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_getWrittenFrames
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioTrackRecorder * recorder = GetHandle<jni::AudioTrackRecorder>(env, caller);
+	CHECK_HANDLEV(recorder, 0);
+
+	return static_cast<jlong>(recorder->getWrittenFrames());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_getDroppedCount
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioTrackRecorder * recorder = GetHandle<jni::AudioTrackRecorder>(env, caller);
+	CHECK_HANDLEV(recorder, 0);
+
+	return static_cast<jlong>(recorder->getDroppedCount());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::AudioTrackRecorder * recorder = GetHandle<jni::AudioTrackRecorder>(env, caller);
+	CHECK_HANDLE(recorder);
+
+	delete recorder;
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_AudioTrackRecorder_initialize
+(JNIEnv * env, jobject caller, jstring jFileName, jboolean wav, jint bufferSize)
+{
+	std::string fileName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jFileName));
+
+	auto format = wav
+		? jni::AudioTrackRecorder::FileFormat::kWav
+		: jni::AudioTrackRecorder::FileFormat::kRaw;
+
+	try {
+		jni::AudioTrackRecorder * recorder = new jni::AudioTrackRecorder(fileName, format,
+			static_cast<size_t>(bufferSize));
+
+		SetHandle(env, caller, recorder);
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
@@ -15,12 +15,58 @@
  */
 
 #include "JNI_CustomAudioSource.h"
+#include "JavaError.h"
+#include "JavaNullPointerException.h"
 #include "JavaUtils.h"
 
 #include "media/audio/CustomAudioSource.h"
 
 #include "rtc_base/logging.h"
 
+// Checks the format and that the audio data holds all frames. The byte count is
+// computed in size_t, so that large frame counts cannot overflow.
+static bool checkAudioData(JNIEnv * env, size_t availableBytes, jint bytesPerSample, jint channels, jint frameCount)
+{
+    if (bytesPerSample <= 0 || channels <= 0 || frameCount <= 0) {
+        env->Throw(jni::JavaError(env, "Invalid audio format: %d bytes per sample, %d channels, %d frames",
+            bytesPerSample, channels, frameCount));
+        return false;
+    }
+
+    const size_t requiredBytes = static_cast<size_t>(frameCount) * static_cast<size_t>(channels) * static_cast<size_t>(bytesPerSample);
+
+    if (requiredBytes > availableBytes) {
+        env->Throw(jni::JavaError(env, "Audio data holds %zu bytes, %zu required", availableBytes, requiredBytes));
+        return false;
+    }
+
+    return true;
+}
+
+// Returns the address at the offset of the direct buffer and the number of
+// bytes behind it, or nullptr if the buffer is not direct or the offset is
+// out of range. The offset and the capacity are given in elements.
+static uint8_t * getDirectAudioData(JNIEnv * env, jobject buffer, jint offset, size_t elementSize, size_t & availableBytes)
+{
+    uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+
+    if (address == nullptr) {
+        env->Throw(jni::JavaError(env, "Audio data is not a direct buffer"));
+        return nullptr;
+    }
+
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+
+    if (offset < 0 || offset > capacity) {
+        env->Throw(jni::JavaError(env, "Audio data offset %d out of range", offset));
+        return nullptr;
+    }
+
+    availableBytes = static_cast<size_t>(capacity - offset) * elementSize;
+
+    return address + static_cast<size_t>(offset) * elementSize;
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_initialize
 (JNIEnv * env, jobject caller)
 {
@@ -65,12 +111,198 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_push
     jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
     CHECK_HANDLE(source);
     
-    jbyte * data = env->GetByteArrayElements(audioData, nullptr);
+    if (audioData == nullptr) {
+        env->Throw(jni::JavaNullPointerException(env, "Audio data is null"));
+        return;
+    }
+    if (bits_per_sample % 8 != 0) {
+        env->Throw(jni::JavaError(env, "Invalid bits per sample: %d", bits_per_sample));
+        return;
+    }
+
     jsize length = env->GetArrayLength(audioData);
-    
+
+    if (!checkAudioData(env, static_cast<size_t>(length), bits_per_sample / 8, channels, frameCount)) {
+        return;
+    }
+
+    jbyte * data = env->GetByteArrayElements(audioData, nullptr);
+
     if (data != nullptr) {
-        source->PushAudioData(data, bits_per_sample, sampleRate, channels, frameCount);
-        
+        try {
+            if (bits_per_sample == 16) {
+                source->PushAudioData(reinterpret_cast<const int16_t *>(data), sampleRate, channels, frameCount);
+            }
+            else {
+                source->PushAudioData(data, bits_per_sample, sampleRate, channels, frameCount);
+            }
+        }
+        catch (...) {
+            ThrowCxxJavaException(env);
+        }
+
         env->ReleaseByteArrayElements(audioData, data, JNI_ABORT);
     }
-}
\ No newline at end of file
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioDirect
+(JNIEnv * env, jobject caller, jobject audioData, jint offset, jint bits_per_sample, jint sampleRate, jint channels, jint frameCount)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    if (bits_per_sample % 8 != 0) {
+        env->Throw(jni::JavaError(env, "Invalid bits per sample: %d", bits_per_sample));
+        return;
+    }
+
+    size_t availableBytes = 0;
+    const uint8_t * data = getDirectAudioData(env, audioData, offset, 1, availableBytes);
+
+    if (data == nullptr || !checkAudioData(env, availableBytes, bits_per_sample / 8, channels, frameCount)) {
+        return;
+    }
+
+    try {
+        if (bits_per_sample == 16) {
+            source->PushAudioData(reinterpret_cast<const int16_t *>(data), sampleRate, channels, frameCount);
+        }
+        else {
+            source->PushAudioData(data, bits_per_sample, sampleRate, channels, frameCount);
+        }
+    }
+    catch (...) {
+        ThrowCxxJavaException(env);
+    }
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioFloat
+(JNIEnv * env, jobject caller, jfloatArray audioData, jint sampleRate, jint channels, jint frameCount)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    const size_t availableBytes = static_cast<size_t>(env->GetArrayLength(audioData)) * sizeof(jfloat);
+
+    if (!checkAudioData(env, availableBytes, sizeof(jfloat), channels, frameCount)) {
+        return;
+    }
+
+    jfloat * data = env->GetFloatArrayElements(audioData, nullptr);
+
+    if (data != nullptr) {
+        try {
+            source->PushAudioData(static_cast<const float *>(data), sampleRate, channels, frameCount);
+        }
+        catch (...) {
+            ThrowCxxJavaException(env);
+        }
+
+        env->ReleaseFloatArrayElements(audioData, data, JNI_ABORT);
+    }
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_pushAudioFloatDirect
+(JNIEnv * env, jobject caller, jobject audioData, jint offset, jint sampleRate, jint channels, jint frameCount)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    size_t availableBytes = 0;
+    const uint8_t * data = getDirectAudioData(env, audioData, offset, sizeof(jfloat), availableBytes);
+
+    if (data == nullptr || !checkAudioData(env, availableBytes, sizeof(jfloat), channels, frameCount)) {
+        return;
+    }
+
+    try {
+        source->PushAudioData(reinterpret_cast<const float *>(data), sampleRate, channels, frameCount);
+    }
+    catch (...) {
+        ThrowCxxJavaException(env);
+    }
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_setTargetFormatInternal
+(JNIEnv * env, jobject caller, jint sampleRate, jint channels)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    try {
+        source->SetTargetFormat(sampleRate, static_cast<size_t>(channels));
+    }
+    catch (...) {
+        ThrowCxxJavaException(env);
+    }
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_startPacingInternal
+(JNIEnv * env, jobject caller, jint sampleRate, jint channels, jint bufferMillis)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    const size_t bufferFrames = static_cast<size_t>(static_cast<int64_t>(sampleRate) * bufferMillis / 1000);
+
+    try {
+        source->StartPacing(sampleRate, static_cast<size_t>(channels), bufferFrames);
+    }
+    catch (...) {
+        ThrowCxxJavaException(env);
+    }
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_stopPacing
+(JNIEnv * env, jobject caller)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLE(source);
+
+    source->StopPacing();
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingBufferedFrames
+(JNIEnv * env, jobject caller)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLEV(source, 0);
+
+    size_t bufferedFrames = 0;
+    uint64_t underruns = 0;
+    uint64_t overruns = 0;
+
+    source->GetPacingStats(bufferedFrames, underruns, overruns);
+
+    return static_cast<jint>(bufferedFrames);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingUnderrunCount
+(JNIEnv * env, jobject caller)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLEV(source, 0);
+
+    size_t bufferedFrames = 0;
+    uint64_t underruns = 0;
+    uint64_t overruns = 0;
+
+    source->GetPacingStats(bufferedFrames, underruns, overruns);
+
+    return static_cast<jlong>(underruns);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_CustomAudioSource_getPacingOverrunCount
+(JNIEnv * env, jobject caller)
+{
+    jni::CustomAudioSource * source = GetHandle<jni::CustomAudioSource>(env, caller);
+    CHECK_HANDLEV(source, 0);
+
+    size_t bufferedFrames = 0;
+    uint64_t underruns = 0;
+    uint64_t overruns = 0;
+
+    source->GetPacingStats(bufferedFrames, underruns, overruns);
+
+    return static_cast<jlong>(overruns);
+}
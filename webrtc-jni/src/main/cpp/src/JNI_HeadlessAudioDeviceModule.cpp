@@ -16,19 +16,26 @@
 
 #include "JNI_HeadlessAudioDeviceModule.h"
 #include "Exception.h"
+#include "JavaEnums.h"
 #include "JavaError.h"
+#include "JavaRef.h"
+#include "JavaString.h"
 #include "JavaUtils.h"
 #include "WebRTCContext.h"
 
 #include "api/HeadlessAudioDeviceModule.h"
+#include "media/audio/AudioCaptureRing.h"
 
 #include "api/scoped_refptr.h"
+#include "rtc_base/system/file_wrapper.h"
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_initialize
-(JNIEnv* env, jobject caller)
+(JNIEnv* env, jobject caller, jobject jClock)
 {
 	jni::WebRTCContext * context = static_cast<jni::WebRTCContext*>(javaContext);
-	webrtc::scoped_refptr<jni::HeadlessAudioDeviceModule> audioModule = jni::HeadlessAudioDeviceModule::Create(context->webrtcEnv);
+	auto clockMode = jni::JavaEnums::toNative<jni::HeadlessAudioDeviceModule::ClockMode>(env, jClock);
+
+	webrtc::scoped_refptr<jni::HeadlessAudioDeviceModule> audioModule = jni::HeadlessAudioDeviceModule::Create(context->webrtcEnv, 48000, 1, clockMode);
 
 	if (!audioModule) {
 		env->Throw(jni::JavaError(env, "Create HeadlessAudioDeviceModule failed"));
@@ -42,3 +49,76 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceMod
 
 	SetHandle(env, caller, audioModule.release());
 }
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_setPlayoutTapInternal
+(JNIEnv * env, jobject caller, jobject jRing)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	jni::AudioCaptureRing * ring = nullptr;
+
+	if (jRing != nullptr) {
+		ring = GetHandle<jni::AudioCaptureRing>(env, jRing);
+		CHECK_HANDLE(ring);
+	}
+
+	audioModule->SetPlayoutTap(ring);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_setPlayoutTapFileInternal
+(JNIEnv * env, jobject caller, jstring jFileName)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLE(audioModule);
+
+	std::string fileName = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jFileName));
+
+	// The WAV writer aborts on files it cannot open, so probe the file first.
+	webrtc::FileWrapper file = webrtc::FileWrapper::OpenWriteOnly(fileName);
+
+	if (!file.is_open()) {
+		env->Throw(jni::JavaError(env, "Open playout tap file %s failed", fileName.c_str()));
+		return;
+	}
+
+	file.Close();
+
+	audioModule->SetPlayoutTapFile(fileName);
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getTickCount
+(JNIEnv * env, jobject caller)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	return static_cast<jlong>(audioModule->GetTickCount());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getAverageTickLateness
+(JNIEnv * env, jobject caller)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	return static_cast<jlong>(audioModule->GetAverageTickLatenessUs());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_getMaxTickLateness
+(JNIEnv * env, jobject caller)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	return static_cast<jlong>(audioModule->GetMaxTickLatenessUs());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_HeadlessAudioDeviceModule_advanceInternal
+(JNIEnv * env, jobject caller, jint ticks)
+{
+	jni::HeadlessAudioDeviceModule * audioModule = GetHandle<jni::HeadlessAudioDeviceModule>(env, caller);
+	CHECK_HANDLEV(audioModule, 0);
+
+	return static_cast<jint>(audioModule->Advance(static_cast<size_t>(ticks)));
+}
@@ -15,7 +15,16 @@
  */
 
 #include "JNI_RTCDataChannel.h"
+#include "api/RTCDataChannelBufferPool.h"
+#include "api/RTCDataChannelCompressionStats.h"
+#include "api/RTCDataChannelCompressor.h"
+#include "api/RTCDataChannelCounters.h"
+#include "api/RTCDataChannelExecutor.h"
 #include "api/RTCDataChannelObserver.h"
+#include "api/RTCDataChannelPoolObserver.h"
+#include "api/RTCDataChannelQueuedObserver.h"
+#include "api/RTCDataChannelSnapshot.h"
+#include "JavaClasses.h"
 #include "JavaEnums.h"
 #include "JavaError.h"
 #include "JavaRef.h"
@@ -23,9 +32,104 @@
 #include "JavaUtils.h"
 
 #include "api/data_channel_interface.h"
+#include "api/make_ref_counted.h"
 #include "rtc_base/logging.h"
 
 #include <memory>
+#include <vector>
+
+// Closes the callback queue of a previously registered queued observer, so
+// that its pending callbacks are dropped, and drops the reference to it.
+static void releaseCallbackQueue(JNIEnv * env, jobject caller)
+{
+	auto queue = GetHandle<jni::RTCDataChannelExecutor::SerialQueue>(env, caller, "callbackQueueHandle");
+
+	if (queue) {
+		queue->close();
+		queue->Release();
+
+		SetHandle<std::nullptr_t>(env, caller, "callbackQueueHandle", nullptr);
+	}
+}
+
+// Returns the per-channel object stored in the given handle field, creating
+// it on first use. Send and register calls may race from different threads,
+// hence the monitor.
+template <typename T, typename Factory>
+static T * getOrCreateHandle(JNIEnv * env, jobject caller, const char * handleName, Factory create)
+{
+	auto object = GetHandle<T>(env, caller, handleName);
+
+	if (object == nullptr) {
+		env->MonitorEnter(caller);
+
+		object = GetHandle<T>(env, caller, handleName);
+
+		if (object == nullptr) {
+			object = create().release();
+
+			SetHandle(env, caller, handleName, object);
+		}
+
+		env->MonitorExit(caller);
+	}
+
+	return object;
+}
+
+// Returns the compressor of the channel, which is enabled if the negotiated
+// protocol asks for compression.
+static jni::RTCDataChannelCompressor * getCompressor(JNIEnv * env, jobject caller, webrtc::DataChannelInterface * channel)
+{
+	return getOrCreateHandle<jni::RTCDataChannelCompressor>(env, caller, "compressionHandle", [channel]() {
+		bool enabled = jni::RTCDataChannelCompressor::isRequested(channel->protocol());
+
+		return webrtc::make_ref_counted<jni::RTCDataChannelCompressor>(enabled);
+	});
+}
+
+static jni::RTCDataChannelCounters * getCounters(JNIEnv * env, jobject caller)
+{
+	return getOrCreateHandle<jni::RTCDataChannelCounters>(env, caller, "countersHandle", []() {
+		return webrtc::make_ref_counted<jni::RTCDataChannelCounters>();
+	});
+}
+
+// Fills 'count' snapshots into the Java array with a single copy.
+static void writeSnapshots(JNIEnv * env, jobjectArray jChannels, jobject caller, jlongArray jOut, jsize count)
+{
+	const auto javaClass = jni::JavaClasses::get<jni::RTCDataChannelSnapshot::JavaRTCDataChannelClass>(env);
+
+	std::vector<jlong> values(static_cast<size_t>(count) * jni::RTCDataChannelSnapshot::kSize);
+
+	for (jsize i = 0; i < count; i++) {
+		jlong * out = values.data() + static_cast<size_t>(i) * jni::RTCDataChannelSnapshot::kSize;
+
+		if (jChannels == nullptr) {
+			jni::RTCDataChannelSnapshot::fill(env, *javaClass, caller, out);
+		}
+		else {
+			jni::JavaLocalRef<jobject> channel(env, env->GetObjectArrayElement(jChannels, i));
+
+			jni::RTCDataChannelSnapshot::fill(env, *javaClass, channel.get(), out);
+		}
+	}
+
+	env->SetLongArrayRegion(jOut, 0, static_cast<jsize>(values.size()), values.data());
+}
+
+// Builds the payload to send, compressed if the channel asks for it.
+static webrtc::CopyOnWriteBuffer encodePayload(JNIEnv * env, jobject caller, webrtc::DataChannelInterface * channel,
+	const uint8_t * data, size_t size)
+{
+	jni::RTCDataChannelCompressor * compressor = getCompressor(env, caller, channel);
+
+	if (compressor->isEnabled()) {
+		return compressor->compress(data, size);
+	}
+
+	return webrtc::CopyOnWriteBuffer(data, size);
+}
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerObserver
 (JNIEnv * env, jobject caller, jobject jObserver)
@@ -33,7 +137,98 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerObserver
 	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
 	CHECK_HANDLE(channel);
 
-	channel->RegisterObserver(new jni::RTCDataChannelObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver)));
+	releaseCallbackQueue(env, caller);
+
+	channel->RegisterObserver(new jni::RTCDataChannelObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver),
+		webrtc::scoped_refptr<jni::RTCDataChannelCompressor>(getCompressor(env, caller, channel)),
+		webrtc::scoped_refptr<jni::RTCDataChannelCounters>(getCounters(env, caller))));
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerPoolObserver
+(JNIEnv * env, jobject caller, jobject jObserver, jobject jPool)
+{
+	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
+	CHECK_HANDLE(channel);
+
+	jni::RTCDataChannelBufferPool * pool = GetHandle<jni::RTCDataChannelBufferPool>(env, jPool);
+	CHECK_HANDLE(pool);
+
+	releaseCallbackQueue(env, caller);
+
+	channel->RegisterObserver(new jni::RTCDataChannelPoolObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver),
+		webrtc::scoped_refptr<jni::RTCDataChannelBufferPool>(pool),
+		webrtc::scoped_refptr<jni::RTCDataChannelCompressor>(getCompressor(env, caller, channel)),
+		webrtc::scoped_refptr<jni::RTCDataChannelCounters>(getCounters(env, caller))));
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_registerQueuedObserver
+(JNIEnv * env, jobject caller, jobject jObserver, jobject jExecutor)
+{
+	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
+	CHECK_HANDLE(channel);
+
+	jni::RTCDataChannelExecutor * executor = GetHandle<jni::RTCDataChannelExecutor>(env, jExecutor);
+	CHECK_HANDLE(executor);
+
+	releaseCallbackQueue(env, caller);
+
+	webrtc::scoped_refptr<jni::RTCDataChannelExecutor::SerialQueue> queue = executor->createQueue();
+
+	channel->RegisterObserver(new jni::RTCDataChannelQueuedObserver(env, jni::JavaGlobalRef<jobject>(env, jObserver), queue,
+		webrtc::scoped_refptr<jni::RTCDataChannelCompressor>(getCompressor(env, caller, channel)),
+		webrtc::scoped_refptr<jni::RTCDataChannelCounters>(getCounters(env, caller))));
+
+	// Keep a reference for the queue depth metric.
+	SetHandle(env, caller, "callbackQueueHandle", queue.release());
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getCallbackQueueDepth
+(JNIEnv * env, jobject caller)
+{
+	auto queue = GetHandle<jni::RTCDataChannelExecutor::SerialQueue>(env, caller, "callbackQueueHandle");
+
+	if (queue == nullptr) {
+		return 0;
+	}
+
+	return static_cast<jint>(queue->getDepth());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_setCompressionThreshold
+(JNIEnv * env, jobject caller, jint threshold)
+{
+	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
+	CHECK_HANDLE(channel);
+
+	if (threshold < 0) {
+		env->Throw(jni::JavaError(env, "Compression threshold must not be negative"));
+		return;
+	}
+
+	getCompressor(env, caller, channel)->setThreshold(static_cast<size_t>(threshold));
+}
+
+JNIEXPORT jobject JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getCompressionStats
+(JNIEnv * env, jobject caller)
+{
+	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
+	CHECK_HANDLEV(channel, nullptr);
+
+	jni::RTCDataChannelCompressor * compressor = getCompressor(env, caller, channel);
+
+	return jni::RTCDataChannelCompressionStats::toJava(env, compressor->getStats()).release();
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_fillSnapshot
+(JNIEnv * env, jobject caller, jlongArray jOut)
+{
+	writeSnapshots(env, nullptr, caller, jOut, 1);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_fillSnapshots
+(JNIEnv * env, jclass, jobjectArray jChannels, jlongArray jOut)
+{
+	writeSnapshots(env, jChannels, nullptr, jOut, env->GetArrayLength(jChannels));
 }
 
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_unregisterObserver
@@ -43,6 +238,8 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_unregisterObserver
 	CHECK_HANDLE(channel);
 
 	channel->UnregisterObserver();
+
+	releaseCallbackQueue(env, caller);
 }
 
 JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_getLabel
@@ -150,6 +347,24 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_dispose
 	webrtc::DataChannelInterface * channel = GetHandle<webrtc::DataChannelInterface>(env, caller);
 	CHECK_HANDLE(channel);
 
+	releaseCallbackQueue(env, caller);
+
+	auto compressor = GetHandle<jni::RTCDataChannelCompressor>(env, caller, "compressionHandle");
+
+	if (compressor) {
+		compressor->Release();
+
+		SetHandle<std::nullptr_t>(env, caller, "compressionHandle", nullptr);
+	}
+
+	auto counters = GetHandle<jni::RTCDataChannelCounters>(env, caller, "countersHandle");
+
+	if (counters) {
+		counters->Release();
+
+		SetHandle<std::nullptr_t>(env, caller, "countersHandle", nullptr);
+	}
+
 	webrtc::RefCountReleaseStatus status = channel->Release();
 
 	if (status != webrtc::RefCountReleaseStatus::kDroppedLastRef) {
@@ -172,9 +387,11 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_sendDirectBuffer
 	if (address != NULL) {
 		jlong bufferLength = env->GetDirectBufferCapacity(jBuffer);
 
-		webrtc::CopyOnWriteBuffer data(address, static_cast<size_t>(bufferLength));
+		webrtc::CopyOnWriteBuffer data = encodePayload(env, caller, channel, address, static_cast<size_t>(bufferLength));
 
-		channel->Send(webrtc::DataBuffer(data, static_cast<bool>(isBinary)));
+		if (channel->Send(webrtc::DataBuffer(data, static_cast<bool>(isBinary)))) {
+			getCounters(env, caller)->countSent(data.size());
+		}
 	}
 	else {
 		env->Throw(jni::JavaError(env, "Non-direct buffer provided"));
@@ -190,12 +407,14 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_sendByteArrayBuffer
 	int8_t * arrayPtr = env->GetByteArrayElements(jBufferArray, nullptr);
 	size_t arrayLength = env->GetArrayLength(jBufferArray);
 
-	webrtc::CopyOnWriteBuffer data(arrayPtr, arrayLength);
+	webrtc::CopyOnWriteBuffer data = encodePayload(env, caller, channel, reinterpret_cast<uint8_t *>(arrayPtr), arrayLength);
 
 	env->ReleaseByteArrayElements(jBufferArray, arrayPtr, JNI_ABORT);
 
 	try {
-		channel->Send(webrtc::DataBuffer(data, static_cast<bool>(isBinary)));
+		if (channel->Send(webrtc::DataBuffer(data, static_cast<bool>(isBinary)))) {
+			getCounters(env, caller)->countSent(data.size());
+		}
 	}
 	catch (...) {
 		ThrowCxxJavaException(env);
@@ -230,9 +449,11 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_sendDirectBufferAsy
 
 		// The data is copied into the CopyOnWriteBuffer before this call
 		// returns, so the caller may reuse the direct buffer immediately.
-		webrtc::CopyOnWriteBuffer data(address + position, static_cast<size_t>(length));
+		webrtc::CopyOnWriteBuffer data = encodePayload(env, caller, channel, address + position, static_cast<size_t>(length));
 
 		channel->SendAsync(webrtc::DataBuffer(data, static_cast<bool>(isBinary)), &logSendAsyncError);
+
+		getCounters(env, caller)->countSent(data.size());
 	}
 	else {
 		env->Throw(jni::JavaError(env, "Non-direct buffer provided"));
@@ -248,9 +469,11 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannel_sendByteArrayBuffer
 	int8_t * arrayPtr = env->GetByteArrayElements(jBufferArray, nullptr);
 	size_t arrayLength = env->GetArrayLength(jBufferArray);
 
-	webrtc::CopyOnWriteBuffer data(arrayPtr, arrayLength);
+	webrtc::CopyOnWriteBuffer data = encodePayload(env, caller, channel, reinterpret_cast<uint8_t *>(arrayPtr), arrayLength);
 
 	env->ReleaseByteArrayElements(jBufferArray, arrayPtr, JNI_ABORT);
 
 	channel->SendAsync(webrtc::DataBuffer(data, static_cast<bool>(isBinary)), &logSendAsyncError);
+
+	getCounters(env, caller)->countSent(data.size());
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_RTCDataChannelBufferPool.h"
+#include "api/RTCDataChannelBufferPool.h"
+#include "Exception.h"
+#include "JavaError.h"
+#include "JavaRef.h"
+#include "JavaUtils.h"
+
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/logging.h"
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_getAvailable
+(JNIEnv * env, jobject caller)
+{
+	jni::RTCDataChannelBufferPool * pool = GetHandle<jni::RTCDataChannelBufferPool>(env, caller);
+	CHECK_HANDLEV(pool, 0);
+
+	return static_cast<jint>(pool->getAvailable());
+}
+
+JNIEXPORT jlong JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_getFallbackCount
+(JNIEnv * env, jobject caller)
+{
+	jni::RTCDataChannelBufferPool * pool = GetHandle<jni::RTCDataChannelBufferPool>(env, caller);
+	CHECK_HANDLEV(pool, 0);
+
+	return static_cast<jlong>(pool->getFallbackCount());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_disposeInternal
+(JNIEnv * env, jobject caller)
+{
+	jni::RTCDataChannelBufferPool * pool = GetHandle<jni::RTCDataChannelBufferPool>(env, caller);
+	CHECK_HANDLE(pool);
+
+	webrtc::RefCountReleaseStatus status = pool->Release();
+
+	if (status != webrtc::RefCountReleaseStatus::kDroppedLastRef) {
+		// Still referenced by a registered data channel observer.
+		RTC_LOG(LS_INFO) << "Buffer pool is still in use by a data channel observer.";
+	}
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	pool = nullptr;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_initialize
+(JNIEnv * env, jobject caller, jobjectArray jBuffers)
+{
+	try {
+		webrtc::scoped_refptr<jni::RTCDataChannelBufferPool> pool =
+			webrtc::make_ref_counted<jni::RTCDataChannelBufferPool>(env, jni::JavaLocalRef<jobjectArray>(env, jBuffers));
+
+		SetHandle(env, caller, pool.release());
+	}
+	catch (...) {
+		ThrowCxxJavaException(env);
+	}
+}
+
+JNIEXPORT jboolean JNICALL Java_dev_onvoid_webrtc_RTCDataChannelBufferPool_releaseInternal
+(JNIEnv * env, jobject caller, jint index)
+{
+	jni::RTCDataChannelBufferPool * pool = GetHandle<jni::RTCDataChannelBufferPool>(env, caller);
+	CHECK_HANDLEV(pool, false);
+
+	return pool->release(index);
+}
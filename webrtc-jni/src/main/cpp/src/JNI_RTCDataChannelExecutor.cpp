@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_RTCDataChannelExecutor.h"
+#include "api/RTCDataChannelExecutor.h"
+#include "JavaRef.h"
+#include "JavaUtils.h"
+
+#include "api/make_ref_counted.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/logging.h"
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelExecutor_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::RTCDataChannelExecutor * executor = GetHandle<jni::RTCDataChannelExecutor>(env, caller);
+	CHECK_HANDLE(executor);
+
+	executor->shutdown();
+
+	webrtc::RefCountReleaseStatus status = executor->Release();
+
+	if (status != webrtc::RefCountReleaseStatus::kDroppedLastRef) {
+		// Still referenced by the queue of a registered data channel observer.
+		RTC_LOG(LS_INFO) << "Data channel executor is still in use by a data channel observer.";
+	}
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	executor = nullptr;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCDataChannelExecutor_initialize
+(JNIEnv * env, jobject caller, jint threadCount)
+{
+	webrtc::scoped_refptr<jni::RTCDataChannelExecutor> executor =
+		webrtc::make_ref_counted<jni::RTCDataChannelExecutor>(static_cast<size_t>(threadCount));
+
+	SetHandle(env, caller, executor.release());
+}
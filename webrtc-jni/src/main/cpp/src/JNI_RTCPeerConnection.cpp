@@ -25,6 +25,7 @@
 #include "api/RTCRtpTransceiverInit.h"
 #include "api/RTCSessionDescription.h"
 #include "api/RTCStatsCollectorCallback.h"
+#include "api/RTCStatsSnapshotCallback.h"
 #include "api/WebRTCUtils.h"
 #include "JavaArray.h"
 #include "JavaEnums.h"
@@ -38,13 +39,38 @@
 #include "JavaString.h"
 #include "JavaUtils.h"
 
+#include "api/make_ref_counted.h"
 #include "api/peer_connection_interface.h"
 #include "api/rtp_receiver_interface.h"
 #include "api/rtp_sender_interface.h"
 
+#include <optional>
 #include <string>
 #include <vector>
 
+// Returns a reference to the stats ID table of the peer connection, which is
+// optionally created on first use. Snapshots and lookups may run on different
+// threads than close(), which releases the table, hence the monitor.
+static webrtc::scoped_refptr<jni::RTCStatsStringTable> getStatsIdTable(JNIEnv * env, jobject caller, bool create)
+{
+	env->MonitorEnter(caller);
+
+	webrtc::scoped_refptr<jni::RTCStatsStringTable> table(GetHandle<jni::RTCStatsStringTable>(env, caller, "statsIdHandle"));
+
+	if (table == nullptr && create) {
+		table = webrtc::make_ref_counted<jni::RTCStatsStringTable>();
+
+		// The handle holds its own reference until close().
+		table->AddRef();
+
+		SetHandle(env, caller, "statsIdHandle", table.get());
+	}
+
+	env->MonitorExit(caller);
+
+	return table;
+}
+
 JNIEXPORT jobjectArray JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getSenders
 (JNIEnv * env, jobject caller)
 {
@@ -512,6 +538,60 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStats__Ldev_o
 	pc->GetStats(callback);
 }
 
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsSnapshot
+(JNIEnv * env, jobject caller, jobject jcallback)
+{
+	webrtc::PeerConnectionInterface * pc = GetHandle<webrtc::PeerConnectionInterface>(env, caller);
+	CHECK_HANDLE(pc);
+
+	if (jcallback == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "RTCStatsSnapshotCallback is null"));
+		return;
+	}
+
+	auto callback = new webrtc::RefCountedObject<jni::RTCStatsSnapshotCallback>(env, jni::JavaGlobalRef<jobject>(env, jcallback),
+		getStatsIdTable(env, caller, true));
+
+	pc->GetStats(callback);
+}
+
+JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsId
+(JNIEnv * env, jobject caller, jint id)
+{
+	webrtc::scoped_refptr<jni::RTCStatsStringTable> table = getStatsIdTable(env, caller, false);
+
+	if (table == nullptr) {
+		return nullptr;
+	}
+
+	std::optional<std::string> statsId = table->get(id);
+
+	if (!statsId) {
+		return nullptr;
+	}
+
+	return jni::JavaString::toJava(env, *statsId).release();
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStatsIdIndex
+(JNIEnv * env, jobject caller, jstring jstatsId)
+{
+	if (jstatsId == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "Stats ID is null"));
+		return -1;
+	}
+
+	webrtc::scoped_refptr<jni::RTCStatsStringTable> table = getStatsIdTable(env, caller, false);
+
+	if (table == nullptr) {
+		return -1;
+	}
+
+	std::string statsId = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jstatsId));
+
+	return table->find(statsId);
+}
+
 JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_getStats__Ldev_onvoid_webrtc_RTCRtpReceiver_2Ldev_onvoid_webrtc_RTCStatsCollectorCallback_2
 (JNIEnv * env, jobject caller, jobject jreceiver, jobject jcallback)
 {
@@ -584,6 +664,19 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_RTCPeerConnection_close
 		    SetHandle<std::nullptr_t>(env, caller, "observerHandle", nullptr);
 			delete observer;
 		}
+
+		env->MonitorEnter(caller);
+
+		auto statsIdTable = GetHandle<jni::RTCStatsStringTable>(env, caller, "statsIdHandle");
+
+		SetHandle<std::nullptr_t>(env, caller, "statsIdHandle", nullptr);
+
+		env->MonitorExit(caller);
+
+		// Pending snapshots and lookups hold their own reference.
+		if (statsIdTable) {
+			statsIdTable->Release();
+		}
 	}
 	catch (...) {
 		ThrowCxxJavaException(env);
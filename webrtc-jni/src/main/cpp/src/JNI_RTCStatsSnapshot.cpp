@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "JNI_RTCStatsSnapshot.h"
+#include "api/RTCStatsSnapshot.h"
+#include "JavaNullPointerException.h"
+#include "JavaString.h"
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_RTCStatsSnapshot_getAttributeId
+(JNIEnv * env, jclass caller, jstring jname)
+{
+	if (jname == nullptr) {
+		env->Throw(jni::JavaNullPointerException(env, "Attribute name is null"));
+		return -1;
+	}
+
+	std::string name = jni::JavaString::toNative(env, jni::JavaLocalRef<jstring>(env, jname));
+
+	return jni::RTCStatsSnapshot::getAttributeId(name);
+}
+
+JNIEXPORT jstring JNICALL Java_dev_onvoid_webrtc_RTCStatsSnapshot_getAttributeName
+(JNIEnv * env, jclass caller, jint id)
+{
+	std::optional<std::string> name = jni::RTCStatsSnapshot::getAttributeName(id);
+
+	if (!name) {
+		return nullptr;
+	}
+
+	return jni::JavaString::toJava(env, *name).release();
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_StreamingAudioResampler.h"
+#include "media/audio/StreamingAudioResampler.h"
+#include "JavaError.h"
+#include "JavaUtils.h"
+
+#include <type_traits>
+
+template <typename T>
+static jint resampleDirect(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jint srcFrames,
+	jobject dst, jint dstOffset, jint dstFrames)
+{
+	jni::StreamingAudioResampler * resampler = GetHandle<jni::StreamingAudioResampler>(env, caller);
+	CHECK_HANDLEV(resampler, 0);
+
+	uint8_t * srcAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(src));
+	uint8_t * dstAddress = static_cast<uint8_t *>(env->GetDirectBufferAddress(dst));
+
+	if (srcAddress == nullptr || dstAddress == nullptr) {
+		env->Throw(jni::JavaError(env, "Audio buffers must be direct buffers"));
+		return 0;
+	}
+
+	// Offsets and capacities are given in buffer elements, bytes for a
+	// ByteBuffer and floats for a FloatBuffer.
+	const size_t elementSize = std::is_same_v<T, float> ? sizeof(float) : 1;
+	const size_t srcCapacity = static_cast<size_t>(env->GetDirectBufferCapacity(src)) * elementSize;
+	const size_t dstCapacity = static_cast<size_t>(env->GetDirectBufferCapacity(dst)) * elementSize;
+	const size_t frameSize = resampler->getChannels() * sizeof(T);
+
+	if (static_cast<size_t>(srcOffset) * elementSize + srcFrames * frameSize > srcCapacity ||
+		static_cast<size_t>(dstOffset) * elementSize + dstFrames * frameSize > dstCapacity) {
+		env->Throw(jni::JavaError(env, "Audio buffers too small for the given frame counts"));
+		return 0;
+	}
+
+	size_t written = resampler->resample(reinterpret_cast<const T *>(srcAddress + srcOffset * elementSize), srcFrames,
+		reinterpret_cast<T *>(dstAddress + dstOffset * elementSize), dstFrames);
+
+	return static_cast<jint>(written);
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::StreamingAudioResampler * resampler = GetHandle<jni::StreamingAudioResampler>(env, caller);
+	CHECK_HANDLE(resampler);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete resampler;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_initialize
+(JNIEnv * env, jobject caller, jint srcSampleRate, jint dstSampleRate, jint channels)
+{
+	jni::StreamingAudioResampler * resampler = new jni::StreamingAudioResampler(srcSampleRate, dstSampleRate, channels);
+
+	SetHandle(env, caller, resampler);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_getAvailableFrames
+(JNIEnv * env, jobject caller)
+{
+	jni::StreamingAudioResampler * resampler = GetHandle<jni::StreamingAudioResampler>(env, caller);
+	CHECK_HANDLEV(resampler, 0);
+
+	return static_cast<jint>(resampler->getAvailableFrames());
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_reset
+(JNIEnv * env, jobject caller)
+{
+	jni::StreamingAudioResampler * resampler = GetHandle<jni::StreamingAudioResampler>(env, caller);
+	CHECK_HANDLE(resampler);
+
+	resampler->reset();
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_resampleDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jint srcFrames, jobject dst, jint dstOffset, jint dstFrames)
+{
+	return resampleDirect<int16_t>(env, caller, src, srcOffset, srcFrames, dst, dstOffset, dstFrames);
+}
+
+JNIEXPORT jint JNICALL Java_dev_onvoid_webrtc_media_audio_StreamingAudioResampler_resampleFloatDirect
+(JNIEnv * env, jobject caller, jobject src, jint srcOffset, jint srcFrames, jobject dst, jint dstOffset, jint dstFrames)
+{
+	return resampleDirect<float>(env, caller, src, srcOffset, srcFrames, dst, dstOffset, dstFrames);
+}
@@ -15,7 +15,9 @@
  */
 
 #include "JNI_VoiceActivityDetector.h"
+#include "media/audio/VoiceActivitySegmenter.h"
 
+#include "JavaError.h"
 #include "JavaObject.h"
 #include "JavaUtils.h"
 
@@ -61,4 +63,41 @@ JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivityDetector_
     webrtc::VoiceActivityDetector * activityDetector = new webrtc::VoiceActivityDetector();
 
     SetHandle(env, caller, activityDetector);
+}
+
+JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivityDetector_segmentDirect
+(JNIEnv * env, jclass caller, jobject buffer, jint offset, jint samples, jint sampleRate, jfloat threshold,
+    jint minSpeechMillis, jint hangoverMillis)
+{
+    uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+
+    if (address == nullptr) {
+        env->Throw(jni::JavaError(env, "Audio buffer must be a direct buffer"));
+        return nullptr;
+    }
+    if (static_cast<size_t>(offset) + static_cast<size_t>(samples) * sizeof(int16_t) > static_cast<size_t>(env->GetDirectBufferCapacity(buffer))) {
+        env->Throw(jni::JavaError(env, "Audio buffer too small for %d samples", samples));
+        return nullptr;
+    }
+
+    jni::VoiceActivitySegmenter segmenter(sampleRate, { threshold, minSpeechMillis, hangoverMillis });
+    std::vector<jni::VoiceActivitySegmenter::Event> events;
+
+    segmenter.process(reinterpret_cast<const int16_t *>(address + offset), samples, events);
+    segmenter.flush(events);
+
+    // Only completed segments are returned, as pairs of start and end offsets.
+    std::vector<jlong> segments;
+
+    for (const auto & event : events) {
+        if (event.end >= 0) {
+            segments.push_back(event.start);
+            segments.push_back(event.end);
+        }
+    }
+
+    jlongArray result = env->NewLongArray(static_cast<jsize>(segments.size()));
+    env->SetLongArrayRegion(result, 0, static_cast<jsize>(segments.size()), segments.data());
+
+    return result;
 }
\ No newline at end of file
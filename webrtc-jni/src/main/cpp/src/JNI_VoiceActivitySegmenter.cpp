@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JNI_VoiceActivitySegmenter.h"
+#include "media/audio/VoiceActivitySegmenter.h"
+#include "JavaError.h"
+#include "JavaUtils.h"
+
+#include <vector>
+
+static jlongArray toEventArray(JNIEnv * env, const std::vector<jni::VoiceActivitySegmenter::Event> & events)
+{
+	if (events.empty()) {
+		return nullptr;
+	}
+
+	std::vector<jlong> values;
+	values.reserve(events.size() * 2);
+
+	for (const auto & event : events) {
+		values.push_back(event.start);
+		values.push_back(event.end);
+	}
+
+	jlongArray result = env->NewLongArray(static_cast<jsize>(values.size()));
+	env->SetLongArrayRegion(result, 0, static_cast<jsize>(values.size()), values.data());
+
+	return result;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_dispose
+(JNIEnv * env, jobject caller)
+{
+	jni::VoiceActivitySegmenter * segmenter = GetHandle<jni::VoiceActivitySegmenter>(env, caller);
+	CHECK_HANDLE(segmenter);
+
+	SetHandle<std::nullptr_t>(env, caller, nullptr);
+
+	delete segmenter;
+}
+
+JNIEXPORT void JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_initialize
+(JNIEnv * env, jobject caller, jint sampleRate, jfloat threshold, jint minSpeechMillis, jint hangoverMillis)
+{
+	jni::VoiceActivitySegmenter * segmenter = new jni::VoiceActivitySegmenter(sampleRate,
+		{ threshold, minSpeechMillis, hangoverMillis });
+
+	SetHandle(env, caller, segmenter);
+}
+
+JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_processDirect
+(JNIEnv * env, jobject caller, jobject buffer, jint offset, jint samples)
+{
+	jni::VoiceActivitySegmenter * segmenter = GetHandle<jni::VoiceActivitySegmenter>(env, caller);
+	CHECK_HANDLEV(segmenter, nullptr);
+
+	uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+
+	if (address == nullptr) {
+		env->Throw(jni::JavaError(env, "Audio buffer must be a direct buffer"));
+		return nullptr;
+	}
+	if (static_cast<size_t>(offset) + static_cast<size_t>(samples) * sizeof(int16_t) > static_cast<size_t>(env->GetDirectBufferCapacity(buffer))) {
+		env->Throw(jni::JavaError(env, "Audio buffer too small for %d samples", samples));
+		return nullptr;
+	}
+
+	std::vector<jni::VoiceActivitySegmenter::Event> events;
+
+	segmenter->process(reinterpret_cast<const int16_t *>(address + offset), samples, events);
+
+	return toEventArray(env, events);
+}
+
+JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_processProbabilitiesInternal
+(JNIEnv * env, jobject caller, jfloatArray probabilities)
+{
+	jni::VoiceActivitySegmenter * segmenter = GetHandle<jni::VoiceActivitySegmenter>(env, caller);
+	CHECK_HANDLEV(segmenter, nullptr);
+
+	const jsize length = env->GetArrayLength(probabilities);
+	std::vector<jfloat> values(length);
+
+	env->GetFloatArrayRegion(probabilities, 0, length, values.data());
+
+	std::vector<jni::VoiceActivitySegmenter::Event> events;
+
+	for (jfloat probability : values) {
+		segmenter->processProbability(probability, events);
+	}
+
+	return toEventArray(env, events);
+}
+
+JNIEXPORT jlongArray JNICALL Java_dev_onvoid_webrtc_media_audio_VoiceActivitySegmenter_flushInternal
+(JNIEnv * env, jobject caller)
+{
+	jni::VoiceActivitySegmenter * segmenter = GetHandle<jni::VoiceActivitySegmenter>(env, caller);
+	CHECK_HANDLEV(segmenter, nullptr);
+
+	std::vector<jni::VoiceActivitySegmenter::Event> events;
+
+	segmenter->flush(events);
+
+	return toEventArray(env, events);
+}
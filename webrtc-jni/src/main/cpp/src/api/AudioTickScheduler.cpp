@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/AudioTickScheduler.h"
+
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+#include <algorithm>
+
+namespace jni
+{
+    AudioTickScheduler & AudioTickScheduler::Instance()
+    {
+        // Intentionally leaked to avoid destruction order issues at exit.
+        static AudioTickScheduler * scheduler = new AudioTickScheduler();
+        return *scheduler;
+    }
+
+    AudioTickScheduler::AudioTickScheduler() :
+        running_(false),
+        next_tick_us_(0)
+    {
+    }
+
+    void AudioTickScheduler::AddClient(Client * client)
+    {
+        std::lock_guard<std::mutex> threadLock(thread_mutex_);
+
+        {
+            webrtc::MutexLock lock(&mutex_);
+
+            if (std::find(clients_.begin(), clients_.end(), client) == clients_.end()) {
+                clients_.push_back(client);
+            }
+
+            if (running_) {
+                return;
+            }
+            running_ = true;
+        }
+
+        next_tick_us_ = 0;
+
+        thread_ = webrtc::PlatformThread::SpawnJoinable(
+            [this] {
+                while (Process()) {
+                }
+            },
+            "webrtc_audio_tick_thread",
+            webrtc::ThreadAttributes().SetPriority(webrtc::ThreadPriority::kRealtime));
+    }
+
+    void AudioTickScheduler::RemoveClient(Client * client)
+    {
+        std::lock_guard<std::mutex> threadLock(thread_mutex_);
+
+        {
+            webrtc::MutexLock lock(&mutex_);
+
+            clients_.erase(std::remove(clients_.begin(), clients_.end(), client), clients_.end());
+
+            if (!clients_.empty() || !running_) {
+                return;
+            }
+            running_ = false;
+        }
+
+        if (!thread_.empty()) {
+            thread_.Finalize();
+        }
+    }
+
+    size_t AudioTickScheduler::ClientCount() const
+    {
+        webrtc::MutexLock lock(&mutex_);
+        return clients_.size();
+    }
+
+    bool AudioTickScheduler::Process()
+    {
+        const int64_t currentTime = webrtc::TimeMicros();
+
+        // Seed the grid on the first tick.
+        if (next_tick_us_ == 0) {
+            next_tick_us_ = currentTime;
+        }
+
+        if (currentTime >= next_tick_us_) {
+            webrtc::MutexLock lock(&mutex_);
+
+            if (!running_) {
+                return false;
+            }
+
+            for (Client * client : clients_) {
+                client->OnTick(next_tick_us_);
+            }
+
+            // Advance the grid by a fixed 10 ms, see HeadlessAudioDeviceModule.
+            next_tick_us_ += 10000;
+
+            // If we fell far behind, resync to now instead of bursting ticks.
+            if (next_tick_us_ < currentTime - 100000) {
+                next_tick_us_ = currentTime;
+            }
+        }
+        else {
+            webrtc::MutexLock lock(&mutex_);
+
+            if (!running_) {
+                return false;
+            }
+        }
+
+        const int64_t sleepMillis = (next_tick_us_ - webrtc::TimeMicros()) / 1000;
+
+        if (sleepMillis > 0) {
+            webrtc::Thread::SleepMs(static_cast<int>(sleepMillis));
+        }
+
+        return true;
+    }
+}
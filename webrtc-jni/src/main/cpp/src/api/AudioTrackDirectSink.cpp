@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/AudioTrackDirectSink.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+#include <cstring>
+
+namespace jni
+{
+	AudioTrackDirectSink::AudioTrackDirectSink(JNIEnv * env, const JavaGlobalRef<jobject> & sink) :
+		sink(sink),
+		buffer(nullptr),
+		capacity(0),
+		javaClass(JavaClasses::get<JavaAudioTrackDirectSinkClass>(env))
+	{
+	}
+
+	void AudioTrackDirectSink::OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels, size_t frames)
+	{
+		JNIEnv * env = AttachCurrentThread();
+
+		const size_t dataSize = frames * channels * (bitsPerSample / 8);
+
+		if (buffer.get() == nullptr || dataSize != capacity) {
+			allocate(env, dataSize);
+		}
+
+		std::memcpy(memory.get(), data, dataSize);
+
+		// Undo any position or limit changes made by the previous callback.
+		JavaLocalRef<jobject> cleared(env, env->CallObjectMethod(buffer, javaClass->clear));
+
+		env->CallVoidMethod(sink, javaClass->onData, buffer.get(), bitsPerSample, sampleRate,
+			static_cast<jint>(channels), static_cast<jint>(frames));
+		ExceptionCheck(env);
+	}
+
+	void AudioTrackDirectSink::allocate(JNIEnv * env, size_t size)
+	{
+		auto newMemory = std::make_unique<uint8_t[]>(size);
+
+		JavaLocalRef<jobject> newBuffer(env, env->NewDirectByteBuffer(newMemory.get(), static_cast<jlong>(size)));
+		JavaLocalRef<jobject> byteOrder(env, env->CallStaticObjectMethod(javaClass->byteOrderClass, javaClass->nativeOrder));
+		JavaLocalRef<jobject> ordered(env, env->CallObjectMethod(newBuffer, javaClass->order, byteOrder.get()));
+
+		buffer = JavaGlobalRef<jobject>(env, newBuffer.get());
+		memory = std::move(newMemory);
+		capacity = size;
+	}
+
+	AudioTrackDirectSink::JavaAudioTrackDirectSinkClass::JavaAudioTrackDirectSinkClass(JNIEnv * env)
+	{
+		jclass cls = FindClass(env, PKG_AUDIO"AudioTrackDirectSink");
+
+		onData = GetMethod(env, cls, "onData", "(Ljava/nio/ByteBuffer;IIII)V");
+
+		jclass bufferClass = FindClass(env, "java/nio/Buffer");
+
+		clear = GetMethod(env, bufferClass, "clear", "()Ljava/nio/Buffer;");
+
+		jclass byteBufferClass = FindClass(env, "java/nio/ByteBuffer");
+
+		order = GetMethod(env, byteBufferClass, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+
+		byteOrderClass = FindClass(env, "java/nio/ByteOrder");
+		nativeOrder = GetStaticMethod(env, byteOrderClass, "nativeOrder", "()Ljava/nio/ByteOrder;");
+	}
+}
@@ -15,19 +15,31 @@
  */
 
 #include "api/HeadlessAudioDeviceModule.h"
+#include "media/audio/WavAudioFileSink.h"
+
+#include "rtc_base/logging.h"
+
+#include <algorithm>
 
 namespace jni
 {
     HeadlessAudioDeviceModule::HeadlessAudioDeviceModule(const webrtc::Environment & env,
                                                          int sample_rate_hz,
-                                                         size_t channels):
+                                                         size_t channels,
+                                                         ClockMode clock_mode):
+            clock_mode_(clock_mode),
             sample_rate_hz_(sample_rate_hz),
             channels_(channels ? channels : 1),
             playoutFramesIn10MS_(0),
             recordingFramesIn10MS_(0),
             nextPlayoutMillis_(0),
             nextRecordMillis_(0),
-            audio_callback_(nullptr)
+            audio_callback_(nullptr),
+            playout_tap_(nullptr),
+            registered_(false),
+            tick_count_(0),
+            tick_lateness_sum_us_(0),
+            max_tick_lateness_us_(0)
     {
         audio_device_buffer_ = std::make_unique<webrtc::AudioDeviceBuffer>(env);
     }
@@ -215,6 +227,11 @@ namespace jni
             audio_device_buffer_->StartPlayout();
         }
 
+        if (clock_mode_ != ClockMode::kRealtime) {
+            UpdateTickRegistration();
+            return 0;
+        }
+
         // Launch 10ms render pull thread.
         render_thread_ = webrtc::PlatformThread::SpawnJoinable(
             [this] {
@@ -238,6 +255,8 @@ namespace jni
             playing_ = false;
         }
 
+        UpdateTickRegistration();
+
         if (!render_thread_.empty()) {
             render_thread_.Finalize();
         }
@@ -272,6 +291,11 @@ namespace jni
             audio_device_buffer_->StartRecording();
         }
 
+        if (clock_mode_ != ClockMode::kRealtime) {
+            UpdateTickRegistration();
+            return 0;
+        }
+
         // Launch 10ms capture push thread.
         capture_thread_ = webrtc::PlatformThread::SpawnJoinable(
             [this] {
@@ -295,6 +319,8 @@ namespace jni
             recording_ = false;
         }
 
+        UpdateTickRegistration();
+
         if (!capture_thread_.empty()) {
             capture_thread_.Finalize();
         }
@@ -442,10 +468,13 @@ namespace jni
             return -1;
         }
 
-        channels_ = enable ? 2u : 1u;
-        // Propagate channel change to AudioDeviceBuffer if playout is initialized.
         webrtc::MutexLock lock(&mutex_);
 
+        if (!SetChannels(enable ? 2u : 1u)) {
+            return -1;
+        }
+
+        // Propagate channel change to AudioDeviceBuffer if playout is initialized.
         const size_t total_samples = channels_ * playoutFramesIn10MS_;
         if (play_buffer_.size() != total_samples) {
             play_buffer_.SetSize(total_samples);
@@ -478,8 +507,10 @@ namespace jni
         if (recording_initialized_) {
             return -1;
         }
-        channels_ = enable ? 2u : 1u;
         webrtc::MutexLock lock(&mutex_);
+        if (!SetChannels(enable ? 2u : 1u)) {
+            return -1;
+        }
         const size_t total_samples = channels_ * recordingFramesIn10MS_;
         if (record_buffer_.size() != total_samples) {
             record_buffer_.SetSize(total_samples);
@@ -541,6 +572,219 @@ namespace jni
         return 0;
     }
 
+    void HeadlessAudioDeviceModule::SetPlayoutTap(AudioSink * tap)
+    {
+        webrtc::MutexLock lock(&mutex_);
+        playout_file_tap_.reset();
+        playout_tap_ = tap;
+    }
+
+    void HeadlessAudioDeviceModule::SetPlayoutTapFile(const std::string & fileName)
+    {
+        // Read the format under the lock, channel changes are rejected while
+        // the file is open.
+        webrtc::MutexLock lock(&mutex_);
+        playout_file_tap_ = std::make_unique<WavAudioFileSink>(fileName, sample_rate_hz_, channels_);
+        playout_tap_ = playout_file_tap_.get();
+    }
+
+    bool HeadlessAudioDeviceModule::SetChannels(size_t channels)
+    {
+        // The WAV header of a playout tap file is written for a fixed format.
+        if (playout_file_tap_ && channels != channels_) {
+            RTC_LOG(LS_WARNING) << "Cannot change the channel count while a playout tap file is set";
+            return false;
+        }
+
+        channels_ = channels;
+        return true;
+    }
+
+    void HeadlessAudioDeviceModule::OnTick(int64_t dueTimeUs)
+    {
+        std::lock_guard<std::mutex> tickLock(tick_mutex_);
+
+        bool playing = false;
+        bool recording = false;
+        {
+            webrtc::MutexLock lock(&mutex_);
+            playing = playing_;
+            recording = recording_;
+        }
+
+        RecordTickLateness(webrtc::TimeMicros() - dueTimeUs);
+
+        // Capture first, as a real device delivers the microphone signal before
+        // it asks for the next playout chunk.
+        if (recording) {
+            CaptureTick();
+        }
+        if (playing) {
+            PlayTick();
+        }
+    }
+
+    size_t HeadlessAudioDeviceModule::Advance(size_t ticks)
+    {
+        if (clock_mode_ != ClockMode::kManual) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> tickLock(tick_mutex_);
+
+        for (size_t i = 0; i < ticks; i++) {
+            bool playing = false;
+            bool recording = false;
+            {
+                webrtc::MutexLock lock(&mutex_);
+                playing = playing_;
+                recording = recording_;
+            }
+
+            if (!playing && !recording) {
+                return i;
+            }
+
+            tick_count_.fetch_add(1, std::memory_order_relaxed);
+
+            // Keep capture and playout in lockstep, in the same order as the
+            // shared clock.
+            if (recording) {
+                CaptureTick();
+            }
+            if (playing) {
+                PlayTick();
+            }
+        }
+
+        return ticks;
+    }
+
+    uint64_t HeadlessAudioDeviceModule::GetTickCount() const
+    {
+        return tick_count_.load(std::memory_order_relaxed);
+    }
+
+    int64_t HeadlessAudioDeviceModule::GetAverageTickLatenessUs() const
+    {
+        const uint64_t count = tick_count_.load(std::memory_order_relaxed);
+
+        if (count == 0) {
+            return 0;
+        }
+        return tick_lateness_sum_us_.load(std::memory_order_relaxed) / static_cast<int64_t>(count);
+    }
+
+    int64_t HeadlessAudioDeviceModule::GetMaxTickLatenessUs() const
+    {
+        return max_tick_lateness_us_.load(std::memory_order_relaxed);
+    }
+
+    void HeadlessAudioDeviceModule::RecordTickLateness(int64_t latenessUs)
+    {
+        latenessUs = std::max<int64_t>(latenessUs, 0);
+
+        tick_count_.fetch_add(1, std::memory_order_relaxed);
+        tick_lateness_sum_us_.fetch_add(latenessUs, std::memory_order_relaxed);
+
+        int64_t max = max_tick_lateness_us_.load(std::memory_order_relaxed);
+        while (latenessUs > max &&
+               !max_tick_lateness_us_.compare_exchange_weak(max, latenessUs, std::memory_order_relaxed)) {
+        }
+    }
+
+    void HeadlessAudioDeviceModule::UpdateTickRegistration()
+    {
+        if (clock_mode_ != ClockMode::kShared) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(registration_mutex_);
+
+        bool active = false;
+        {
+            // Not held while calling the scheduler, which ticks under its own lock.
+            webrtc::MutexLock stateLock(&mutex_);
+            active = playing_ || recording_;
+        }
+
+        if (active && !registered_) {
+            AudioTickScheduler::Instance().AddClient(this);
+            registered_ = true;
+        }
+        else if (!active && registered_) {
+            AudioTickScheduler::Instance().RemoveClient(this);
+            registered_ = false;
+        }
+
+        // Wait for a tick that may still be processing a direction that was
+        // just stopped.
+        std::lock_guard<std::mutex> tickLock(tick_mutex_);
+    }
+
+    void HeadlessAudioDeviceModule::PlayTick()
+    {
+        // Not under the lock, the transport may take a while to mix.
+        audio_device_buffer_->RequestPlayoutData(playoutFramesIn10MS_);
+
+        webrtc::MutexLock lock(&mutex_);
+
+        audio_device_buffer_->GetPlayoutData(play_buffer_.data());
+
+        if (playout_tap_) {
+            uint32_t newMicLevel = 0;
+
+            // Hand the mixed signal over; the tap copies what it needs.
+            playout_tap_->RecordedDataIsAvailable(play_buffer_.data(),
+                                                  playoutFramesIn10MS_,
+                                                  sizeof(int16_t) * channels_,
+                                                  channels_,
+                                                  static_cast<uint32_t>(sample_rate_hz_),
+                                                  0, 0, 0, false, newMicLevel);
+        }
+    }
+
+    void HeadlessAudioDeviceModule::CaptureTick()
+    {
+        mutex_.Lock();
+
+        webrtc::AudioTransport * callback = audio_callback_;
+        size_t nSamplesOut = 0;
+        const size_t nBytesPerSample = sizeof(int16_t);
+        const size_t nChannels = channels_;
+        const uint32_t samplesPerSec = static_cast<uint32_t>(sample_rate_hz_);
+        int64_t elapsed_time_ms = 0;
+        int64_t ntp_time_ms = 0;
+
+        if (callback) {
+            // Pull 10 ms of audio from the registered AudioTransport (Java AudioSource).
+            callback->NeedMorePlayData(recordingFramesIn10MS_ * nChannels,
+                                       nBytesPerSample,
+                                       nChannels,
+                                       samplesPerSec,
+                                       record_buffer_.data(),
+                                       nSamplesOut,
+                                       &elapsed_time_ms,
+                                       &ntp_time_ms);
+        }
+        else {
+            nSamplesOut = recordingFramesIn10MS_ * nChannels;
+            std::memset(record_buffer_.data(), 0, nSamplesOut * nBytesPerSample);
+        }
+
+        if (nChannels == 0) {
+            mutex_.Unlock();
+            return;
+        }
+
+        // Feed the captured buffer to WebRTC.
+        audio_device_buffer_->SetRecordedBuffer(record_buffer_.data(), recordingFramesIn10MS_);
+        audio_device_buffer_->SetVQEData(/*play_delay_ms*/ 0, /*rec_delay_ms*/ 0);
+
+        mutex_.Unlock();
+        audio_device_buffer_->DeliverRecordedData();
+    }
+
     bool HeadlessAudioDeviceModule::PlayThreadProcess()
     {
         {
@@ -559,12 +803,12 @@ namespace jni
         }
 
         if (currentTime >= nextPlayoutMillis_) {
+            RecordTickLateness(webrtc::TimeMicros() - nextPlayoutMillis_ * 1000);
+
             mutex_.Unlock();
-            audio_device_buffer_->RequestPlayoutData(playoutFramesIn10MS_);
+            PlayTick();
             mutex_.Lock();
 
-            audio_device_buffer_->GetPlayoutData(play_buffer_.data());
-
             // Advance the grid by a fixed 10 ms rather than re-anchoring to currentTime,
             // so wake-up latency is corrected on the next tick instead of accumulating
             // into the frame period (which otherwise pulls the effective rate below 100 Hz).
@@ -589,13 +833,11 @@ namespace jni
 
     bool HeadlessAudioDeviceModule::CaptureThreadProcess()
     {
-        webrtc::AudioTransport* callback = nullptr;
         {
             webrtc::MutexLock lock(&mutex_);
             if (!recording_) {
                 return false;
             }
-            callback = audio_callback_;
         }
 
         int64_t currentTime = webrtc::TimeMillis();
@@ -607,48 +849,21 @@ namespace jni
         }
 
         if (currentTime >= nextRecordMillis_) {
-            size_t nSamplesOut = 0;
-            const size_t nBytesPerSample = sizeof(int16_t);
-            const size_t nChannels = channels_;
-            const uint32_t samplesPerSec = static_cast<uint32_t>(sample_rate_hz_);
-            int64_t elapsed_time_ms = 0;
-            int64_t ntp_time_ms = 0;
-
-            if (callback) {
-                // Pull 10 ms of audio from the registered AudioTransport (Java AudioSource).
-                callback->NeedMorePlayData(recordingFramesIn10MS_ * nChannels,
-                                           nBytesPerSample,
-                                           nChannels,
-                                           samplesPerSec,
-                                           record_buffer_.data(),
-                                           nSamplesOut,
-                                           &elapsed_time_ms,
-                                           &ntp_time_ms);
-            }
-            else {
-                nSamplesOut = recordingFramesIn10MS_ * nChannels;
-                std::memset(record_buffer_.data(), 0, nSamplesOut * nBytesPerSample);
-            }
-
-            if (nChannels > 0) {
-                // Feed the captured buffer to WebRTC.
-                audio_device_buffer_->SetRecordedBuffer(record_buffer_.data(), recordingFramesIn10MS_);
-                audio_device_buffer_->SetVQEData(/*play_delay_ms*/ 0, /*rec_delay_ms*/ 0);
+            RecordTickLateness(webrtc::TimeMicros() - nextRecordMillis_ * 1000);
 
-                // Advance the grid by a fixed 10 ms rather than re-anchoring to currentTime,
-                // so wake-up latency is corrected on the next tick instead of accumulating
-                // into the frame period (which otherwise pulls the effective rate below 100 Hz).
-                nextRecordMillis_ += 10;
+            mutex_.Unlock();
+            CaptureTick();
+            mutex_.Lock();
 
-                // If we fell far behind (e.g. the thread was descheduled), resync to now
-                // instead of bursting frames to catch up.
-                if (nextRecordMillis_ < currentTime - 100) {
-                    nextRecordMillis_ = currentTime;
-                }
+            // Advance the grid by a fixed 10 ms rather than re-anchoring to currentTime,
+            // so wake-up latency is corrected on the next tick instead of accumulating
+            // into the frame period (which otherwise pulls the effective rate below 100 Hz).
+            nextRecordMillis_ += 10;
 
-                mutex_.Unlock();
-                audio_device_buffer_->DeliverRecordedData();
-                mutex_.Lock();
+            // If we fell far behind (e.g. the thread was descheduled), resync to now
+            // instead of bursting frames to catch up.
+            if (nextRecordMillis_ < currentTime - 100) {
+                nextRecordMillis_ = currentTime;
             }
         }
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelBufferPool.h"
+#include "Exception.h"
+
+#include <cstring>
+
+namespace jni
+{
+	RTCDataChannelBufferPool::RTCDataChannelBufferPool(JNIEnv * env, const JavaRef<jobjectArray> & bufferArray) :
+		cursor(0),
+		fallbackCount(0)
+	{
+		const jsize count = env->GetArrayLength(bufferArray);
+
+		buffers.reserve(count);
+		addresses.reserve(count);
+		capacities.reserve(count);
+		claimed = std::make_unique<std::atomic<bool>[]>(count);
+
+		for (jsize i = 0; i < count; i++) {
+			JavaLocalRef<jobject> buffer(env, env->GetObjectArrayElement(bufferArray, i));
+
+			uint8_t * address = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+
+			if (address == nullptr) {
+				throw Exception("Buffer at index %d is not a direct buffer", i);
+			}
+
+			buffers.emplace_back(env, buffer.get());
+			addresses.push_back(address);
+			capacities.push_back(static_cast<size_t>(env->GetDirectBufferCapacity(buffer)));
+			claimed[i].store(false, std::memory_order_relaxed);
+		}
+	}
+
+	int RTCDataChannelBufferPool::acquire(const uint8_t * data, size_t size)
+	{
+		const size_t count = addresses.size();
+
+		if (count > 0) {
+			const size_t start = cursor.fetch_add(1, std::memory_order_relaxed);
+
+			for (size_t i = 0; i < count; i++) {
+				const size_t index = (start + i) % count;
+
+				if (capacities[index] < size) {
+					continue;
+				}
+
+				bool expected = false;
+
+				if (claimed[index].compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+					std::memcpy(addresses[index], data, size);
+
+					return static_cast<int>(index);
+				}
+			}
+		}
+
+		fallbackCount.fetch_add(1, std::memory_order_relaxed);
+
+		return -1;
+	}
+
+	bool RTCDataChannelBufferPool::release(int index)
+	{
+		if (index < 0 || static_cast<size_t>(index) >= addresses.size()) {
+			return false;
+		}
+
+		bool expected = true;
+
+		return claimed[index].compare_exchange_strong(expected, false, std::memory_order_release);
+	}
+
+	size_t RTCDataChannelBufferPool::getSize() const
+	{
+		return addresses.size();
+	}
+
+	size_t RTCDataChannelBufferPool::getAvailable() const
+	{
+		size_t available = 0;
+
+		for (size_t i = 0; i < addresses.size(); i++) {
+			if (!claimed[i].load(std::memory_order_relaxed)) {
+				available++;
+			}
+		}
+
+		return available;
+	}
+
+	uint64_t RTCDataChannelBufferPool::getFallbackCount() const
+	{
+		return fallbackCount.load(std::memory_order_relaxed);
+	}
+}
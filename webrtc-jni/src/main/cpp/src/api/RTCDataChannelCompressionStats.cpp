@@ -0,0 +1,48 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelCompressionStats.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+namespace jni
+{
+	namespace RTCDataChannelCompressionStats
+	{
+		JavaLocalRef<jobject> toJava(JNIEnv * env, const RTCDataChannelCompressor::Stats & stats)
+		{
+			const auto javaClass = JavaClasses::get<JavaRTCDataChannelCompressionStatsClass>(env);
+
+			jobject obj = env->NewObject(javaClass->cls, javaClass->ctor,
+				static_cast<jlong>(stats.messagesSent),
+				static_cast<jlong>(stats.messagesCompressed),
+				static_cast<jlong>(stats.bytesSent),
+				static_cast<jlong>(stats.wireBytesSent),
+				static_cast<jlong>(stats.messagesReceived),
+				static_cast<jlong>(stats.bytesReceived),
+				static_cast<jlong>(stats.wireBytesReceived));
+
+			return JavaLocalRef<jobject>(env, obj);
+		}
+
+		JavaRTCDataChannelCompressionStatsClass::JavaRTCDataChannelCompressionStatsClass(JNIEnv * env)
+		{
+			cls = FindClass(env, PKG"RTCDataChannelCompressionStats");
+
+			ctor = GetMethod(env, cls, "<init>", "(JJJJJJJ)V");
+		}
+	}
+}
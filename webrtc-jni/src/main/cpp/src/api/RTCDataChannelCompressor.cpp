@@ -0,0 +1,224 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelCompressor.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace jni
+{
+	constexpr uint8_t kRawPayload = 0;
+	constexpr uint8_t kDeflatePayload = 1;
+
+	// Upper bound of an inflated message, protecting against payloads that
+	// expand without limit.
+	constexpr size_t kMaxMessageSize = 16 * 1024 * 1024;
+
+	bool RTCDataChannelCompressor::isRequested(std::string_view protocol)
+	{
+		while (!protocol.empty()) {
+			size_t end = protocol.find(',');
+			std::string_view token = protocol.substr(0, end);
+
+			size_t first = token.find_first_not_of(' ');
+			size_t last = token.find_last_not_of(' ');
+
+			if (first != std::string_view::npos && token.substr(first, last - first + 1) == kProtocolToken) {
+				return true;
+			}
+			if (end == std::string_view::npos) {
+				break;
+			}
+
+			protocol.remove_prefix(end + 1);
+		}
+
+		return false;
+	}
+
+	RTCDataChannelCompressor::RTCDataChannelCompressor(bool enabled) :
+		enabled(enabled),
+		threshold(kDefaultThreshold),
+		deflateStream(),
+		inflateStream(),
+		messagesSent(0),
+		messagesCompressed(0),
+		bytesSent(0),
+		wireBytesSent(0),
+		messagesReceived(0),
+		bytesReceived(0),
+		wireBytesReceived(0)
+	{
+		if (enabled) {
+			// Raw deflate without zlib header and checksum; SCTP already
+			// protects the payload. Favour speed, as this runs on the send
+			// path.
+			deflateInit2(&deflateStream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+			inflateInit2(&inflateStream, -MAX_WBITS);
+		}
+	}
+
+	RTCDataChannelCompressor::~RTCDataChannelCompressor()
+	{
+		if (enabled) {
+			deflateEnd(&deflateStream);
+			inflateEnd(&inflateStream);
+		}
+	}
+
+	bool RTCDataChannelCompressor::isEnabled() const
+	{
+		return enabled;
+	}
+
+	void RTCDataChannelCompressor::setThreshold(size_t threshold)
+	{
+		this->threshold.store(threshold, std::memory_order_relaxed);
+	}
+
+	webrtc::CopyOnWriteBuffer RTCDataChannelCompressor::compress(const uint8_t * data, size_t size)
+	{
+		messagesSent.fetch_add(1, std::memory_order_relaxed);
+		bytesSent.fetch_add(size, std::memory_order_relaxed);
+
+		if (size < threshold.load(std::memory_order_relaxed)) {
+			return frameRaw(data, size);
+		}
+
+		std::lock_guard<std::mutex> lock(deflateMutex);
+
+		const size_t bound = deflateBound(&deflateStream, static_cast<uLong>(size));
+
+		webrtc::CopyOnWriteBuffer payload(1 + bound);
+		uint8_t * out = payload.MutableData();
+
+		deflateReset(&deflateStream);
+
+		deflateStream.next_in = const_cast<Bytef *>(data);
+		deflateStream.avail_in = static_cast<uInt>(size);
+		deflateStream.next_out = out + 1;
+		deflateStream.avail_out = static_cast<uInt>(bound);
+
+		int result = deflate(&deflateStream, Z_FINISH);
+
+		if (result != Z_STREAM_END || deflateStream.total_out >= size) {
+			// Incompressible data, don't pay for inflating it.
+			return frameRaw(data, size);
+		}
+
+		out[0] = kDeflatePayload;
+		payload.SetSize(1 + deflateStream.total_out);
+
+		messagesCompressed.fetch_add(1, std::memory_order_relaxed);
+		wireBytesSent.fetch_add(payload.size(), std::memory_order_relaxed);
+
+		return payload;
+	}
+
+	bool RTCDataChannelCompressor::decompress(const webrtc::CopyOnWriteBuffer & payload, webrtc::CopyOnWriteBuffer * data)
+	{
+		if (payload.empty()) {
+			return false;
+		}
+
+		const uint8_t header = payload.cdata()[0];
+		const size_t size = payload.size() - 1;
+
+		if (header == kRawPayload) {
+			// Shares the memory with the payload.
+			*data = payload.Slice(1, size);
+		}
+		else if (header == kDeflatePayload) {
+			std::lock_guard<std::mutex> lock(inflateMutex);
+
+			size_t capacity = std::min(std::max<size_t>(size * 4, 1024), kMaxMessageSize);
+
+			data->SetSize(capacity);
+
+			inflateReset(&inflateStream);
+
+			inflateStream.next_in = const_cast<Bytef *>(payload.cdata() + 1);
+			inflateStream.avail_in = static_cast<uInt>(size);
+
+			while (true) {
+				inflateStream.next_out = data->MutableData() + inflateStream.total_out;
+				inflateStream.avail_out = static_cast<uInt>(capacity - inflateStream.total_out);
+
+				int result = inflate(&inflateStream, Z_NO_FLUSH);
+
+				if (result == Z_STREAM_END) {
+					break;
+				}
+				if (result != Z_OK && result != Z_BUF_ERROR) {
+					return false;
+				}
+				if (inflateStream.avail_out != 0) {
+					// No progress possible, the payload is truncated.
+					return false;
+				}
+				if (capacity == kMaxMessageSize) {
+					return false;
+				}
+
+				capacity = std::min(capacity * 2, kMaxMessageSize);
+
+				data->SetSize(capacity);
+			}
+
+			data->SetSize(inflateStream.total_out);
+		}
+		else {
+			return false;
+		}
+
+		messagesReceived.fetch_add(1, std::memory_order_relaxed);
+		bytesReceived.fetch_add(data->size(), std::memory_order_relaxed);
+		wireBytesReceived.fetch_add(payload.size(), std::memory_order_relaxed);
+
+		return true;
+	}
+
+	RTCDataChannelCompressor::Stats RTCDataChannelCompressor::getStats() const
+	{
+		Stats stats;
+		stats.messagesSent = messagesSent.load(std::memory_order_relaxed);
+		stats.messagesCompressed = messagesCompressed.load(std::memory_order_relaxed);
+		stats.bytesSent = bytesSent.load(std::memory_order_relaxed);
+		stats.wireBytesSent = wireBytesSent.load(std::memory_order_relaxed);
+		stats.messagesReceived = messagesReceived.load(std::memory_order_relaxed);
+		stats.bytesReceived = bytesReceived.load(std::memory_order_relaxed);
+		stats.wireBytesReceived = wireBytesReceived.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	webrtc::CopyOnWriteBuffer RTCDataChannelCompressor::frameRaw(const uint8_t * data, size_t size)
+	{
+		webrtc::CopyOnWriteBuffer payload(1 + size);
+		uint8_t * out = payload.MutableData();
+
+		out[0] = kRawPayload;
+
+		if (size > 0) {
+			std::memcpy(out + 1, data, size);
+		}
+
+		wireBytesSent.fetch_add(payload.size(), std::memory_order_relaxed);
+
+		return payload;
+	}
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelCounters.h"
+
+namespace jni
+{
+	RTCDataChannelCounters::RTCDataChannelCounters() :
+		messagesSent(0),
+		bytesSent(0),
+		messagesReceived(0),
+		bytesReceived(0),
+		id(-1)
+	{
+	}
+
+	void RTCDataChannelCounters::countSent(size_t size)
+	{
+		messagesSent.fetch_add(1, std::memory_order_relaxed);
+		bytesSent.fetch_add(size, std::memory_order_relaxed);
+	}
+
+	void RTCDataChannelCounters::countReceived(size_t size)
+	{
+		messagesReceived.fetch_add(1, std::memory_order_relaxed);
+		bytesReceived.fetch_add(size, std::memory_order_relaxed);
+	}
+
+	uint64_t RTCDataChannelCounters::getMessagesSent() const
+	{
+		return messagesSent.load(std::memory_order_relaxed);
+	}
+
+	uint64_t RTCDataChannelCounters::getBytesSent() const
+	{
+		return bytesSent.load(std::memory_order_relaxed);
+	}
+
+	uint64_t RTCDataChannelCounters::getMessagesReceived() const
+	{
+		return messagesReceived.load(std::memory_order_relaxed);
+	}
+
+	uint64_t RTCDataChannelCounters::getBytesReceived() const
+	{
+		return bytesReceived.load(std::memory_order_relaxed);
+	}
+
+	int RTCDataChannelCounters::getId(webrtc::DataChannelInterface * channel)
+	{
+		int value = id.load(std::memory_order_relaxed);
+
+		if (value < 0) {
+			value = channel->id();
+
+			if (value >= 0) {
+				id.store(value, std::memory_order_relaxed);
+			}
+		}
+
+		return value;
+	}
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelExecutor.h"
+
+#include "api/make_ref_counted.h"
+
+#include <string>
+
+namespace jni
+{
+	// Upper bound of tasks a worker runs from one queue before it yields to
+	// other queues waiting for a worker.
+	constexpr size_t kMaxTasksPerRun = 64;
+
+	RTCDataChannelExecutor::SerialQueue::SerialQueue(webrtc::scoped_refptr<RTCDataChannelExecutor> executor) :
+		executor(executor),
+		scheduled(false),
+		closed(false)
+	{
+	}
+
+	void RTCDataChannelExecutor::SerialQueue::post(std::function<void()> task)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (closed) {
+			return;
+		}
+
+		tasks.push_back(std::move(task));
+
+		if (scheduled) {
+			// A worker owns this queue and will pick up the task.
+			return;
+		}
+
+		scheduled = executor->schedule(webrtc::scoped_refptr<SerialQueue>(this));
+
+		if (!scheduled) {
+			tasks.clear();
+		}
+	}
+
+	void RTCDataChannelExecutor::SerialQueue::close()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		closed = true;
+		tasks.clear();
+
+		if (runner == std::this_thread::get_id()) {
+			// Closed by the running task itself.
+			return;
+		}
+
+		idle.wait(lock, [this] {
+			return runner == std::thread::id();
+		});
+	}
+
+	size_t RTCDataChannelExecutor::SerialQueue::getDepth() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		return tasks.size();
+	}
+
+	bool RTCDataChannelExecutor::SerialQueue::run()
+	{
+		for (size_t i = 0; i < kMaxTasksPerRun; i++) {
+			std::function<void()> task;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				if (tasks.empty()) {
+					scheduled = false;
+					return false;
+				}
+
+				task = std::move(tasks.front());
+				tasks.pop_front();
+
+				runner = std::this_thread::get_id();
+			}
+
+			task();
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				runner = std::thread::id();
+			}
+
+			idle.notify_all();
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+
+		scheduled = !tasks.empty();
+
+		return scheduled;
+	}
+
+	void RTCDataChannelExecutor::SerialQueue::clear()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		tasks.clear();
+		scheduled = false;
+	}
+
+	RTCDataChannelExecutor::RTCDataChannelExecutor(size_t threadCount) :
+		running(true)
+	{
+		workers.reserve(threadCount);
+
+		for (size_t i = 0; i < threadCount; i++) {
+			workers.push_back(webrtc::PlatformThread::SpawnJoinable(
+				[this] {
+					process();
+				},
+				"webrtc_jni_data_channel_worker_" + std::to_string(i)));
+		}
+	}
+
+	RTCDataChannelExecutor::~RTCDataChannelExecutor()
+	{
+		shutdown();
+	}
+
+	webrtc::scoped_refptr<RTCDataChannelExecutor::SerialQueue> RTCDataChannelExecutor::createQueue()
+	{
+		return webrtc::make_ref_counted<SerialQueue>(webrtc::scoped_refptr<RTCDataChannelExecutor>(this));
+	}
+
+	void RTCDataChannelExecutor::shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (!running) {
+				return;
+			}
+
+			running = false;
+		}
+
+		condition.notify_all();
+
+		// Joins the worker threads.
+		workers.clear();
+
+		std::deque<webrtc::scoped_refptr<SerialQueue>> dropped;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			dropped.swap(readyQueues);
+		}
+
+		for (const auto & queue : dropped) {
+			queue->clear();
+		}
+	}
+
+	bool RTCDataChannelExecutor::schedule(webrtc::scoped_refptr<SerialQueue> queue)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (!running) {
+				return false;
+			}
+
+			readyQueues.push_back(std::move(queue));
+		}
+
+		condition.notify_one();
+
+		return true;
+	}
+
+	void RTCDataChannelExecutor::process()
+	{
+		while (true) {
+			webrtc::scoped_refptr<SerialQueue> queue;
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+
+				condition.wait(lock, [this] {
+					return !running || !readyQueues.empty();
+				});
+
+				if (!running) {
+					return;
+				}
+
+				queue = std::move(readyQueues.front());
+				readyQueues.pop_front();
+			}
+
+			// If more tasks arrived while running, queue up behind the
+			// other channels.
+			if (queue->run() && !schedule(queue)) {
+				queue->clear();
+			}
+		}
+	}
+}
@@ -19,11 +19,17 @@
 #include "JavaUtils.h"
 #include "JNI_WebRTC.h"
 
+#include "rtc_base/logging.h"
+
 namespace jni
 {
-	RTCDataChannelObserver::RTCDataChannelObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer) :
+	RTCDataChannelObserver::RTCDataChannelObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+		webrtc::scoped_refptr<RTCDataChannelCompressor> compressor,
+		webrtc::scoped_refptr<RTCDataChannelCounters> counters) :
 		observer(observer),
 		bufferFactory(std::make_unique<DataBufferFactory>(env, PKG"RTCDataChannelBuffer")),
+		compressor(compressor),
+		counters(counters),
 		javaClass(JavaClasses::get<JavaRTCDataChannelObserverClass>(env))
 	{
 	}
@@ -38,6 +44,43 @@ namespace jni
 	}
 
 	void RTCDataChannelObserver::OnMessage(const webrtc::DataBuffer & buffer)
+	{
+		countReceived(buffer);
+		deliverMessage(buffer);
+	}
+
+	void RTCDataChannelObserver::countReceived(const webrtc::DataBuffer & buffer)
+	{
+		if (counters != nullptr) {
+			counters->countReceived(buffer.size());
+		}
+	}
+
+	void RTCDataChannelObserver::deliverMessage(const webrtc::DataBuffer & buffer)
+	{
+		webrtc::DataBuffer decoded(webrtc::CopyOnWriteBuffer(), buffer.binary);
+		const webrtc::DataBuffer * message = decode(buffer, &decoded);
+
+		if (message != nullptr) {
+			dispatchMessage(*message);
+		}
+	}
+
+	const webrtc::DataBuffer * RTCDataChannelObserver::decode(const webrtc::DataBuffer & buffer, webrtc::DataBuffer * decoded)
+	{
+		if (compressor == nullptr || !compressor->isEnabled()) {
+			return &buffer;
+		}
+
+		if (!compressor->decompress(buffer.data, &decoded->data)) {
+			RTC_LOG(LS_WARNING) << "Dropped malformed compressed data channel message";
+			return nullptr;
+		}
+
+		return decoded;
+	}
+
+	void RTCDataChannelObserver::dispatchMessage(const webrtc::DataBuffer & buffer)
 	{
 		JNIEnv * env = AttachCurrentThread();
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelPoolObserver.h"
+#include "JavaClasses.h"
+#include "JavaUtils.h"
+#include "JNI_WebRTC.h"
+
+namespace jni
+{
+	RTCDataChannelPoolObserver::RTCDataChannelPoolObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+		webrtc::scoped_refptr<RTCDataChannelBufferPool> pool,
+		webrtc::scoped_refptr<RTCDataChannelCompressor> compressor,
+		webrtc::scoped_refptr<RTCDataChannelCounters> counters) :
+		RTCDataChannelObserver(env, observer, compressor, counters),
+		pool(pool),
+		javaPoolClass(JavaClasses::get<JavaRTCDataChannelPoolObserverClass>(env))
+	{
+	}
+
+	void RTCDataChannelPoolObserver::OnMessage(const webrtc::DataBuffer & buffer)
+	{
+		countReceived(buffer);
+
+		webrtc::DataBuffer decoded(webrtc::CopyOnWriteBuffer(), buffer.binary);
+		const webrtc::DataBuffer * message = decode(buffer, &decoded);
+
+		if (message == nullptr) {
+			return;
+		}
+
+		const int index = pool->acquire(message->data.cdata(), message->data.size());
+
+		if (index < 0) {
+			// No free buffer can hold this message.
+			dispatchMessage(*message);
+			return;
+		}
+
+		JNIEnv * env = AttachCurrentThread();
+
+		env->CallVoidMethod(observer, javaPoolClass->onPooledMessage, static_cast<jint>(index),
+			static_cast<jint>(message->data.size()), static_cast<jboolean>(message->binary));
+
+		ExceptionCheck(env);
+	}
+
+	RTCDataChannelPoolObserver::JavaRTCDataChannelPoolObserverClass::JavaRTCDataChannelPoolObserverClass(JNIEnv * env)
+	{
+		jclass cls = FindClass(env, PKG"RTCDataChannelPoolObserver");
+
+		onPooledMessage = GetMethod(env, cls, "onPooledMessage", "(IIZ)V");
+	}
+}
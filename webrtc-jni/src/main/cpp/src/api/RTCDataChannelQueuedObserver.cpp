@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelQueuedObserver.h"
+
+namespace jni
+{
+	RTCDataChannelQueuedObserver::RTCDataChannelQueuedObserver(JNIEnv * env, const JavaGlobalRef<jobject> & observer,
+		webrtc::scoped_refptr<RTCDataChannelExecutor::SerialQueue> queue,
+		webrtc::scoped_refptr<RTCDataChannelCompressor> compressor,
+		webrtc::scoped_refptr<RTCDataChannelCounters> counters) :
+		RTCDataChannelObserver(env, observer, compressor, counters),
+		queue(queue)
+	{
+	}
+
+	void RTCDataChannelQueuedObserver::OnStateChange()
+	{
+		queue->post([this]() {
+			RTCDataChannelObserver::OnStateChange();
+		});
+	}
+
+	void RTCDataChannelQueuedObserver::OnMessage(const webrtc::DataBuffer & buffer)
+	{
+		// Copying the DataBuffer shares the payload, it does not copy it.
+		// Decompression, if any, runs on the worker as well.
+		countReceived(buffer);
+
+		queue->post([this, buffer]() {
+			deliverMessage(buffer);
+		});
+	}
+
+	void RTCDataChannelQueuedObserver::OnBufferedAmountChange(uint64_t sent_data_size)
+	{
+		queue->post([this, sent_data_size]() {
+			RTCDataChannelObserver::OnBufferedAmountChange(sent_data_size);
+		});
+	}
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "api/RTCDataChannelSnapshot.h"
+#include "api/RTCDataChannelCounters.h"
+#include "JavaUtils.h"
+#include "JNI_WebRTC.h"
+
+#include "api/data_channel_interface.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	namespace RTCDataChannelSnapshot
+	{
+		void fill(JNIEnv * env, const JavaRTCDataChannelClass & javaClass, jobject channel, jlong * out)
+		{
+			std::fill(out, out + kSize, 0);
+
+			out[kState] = -1;
+			out[kId] = -1;
+
+			if (channel == nullptr) {
+				return;
+			}
+
+			auto dataChannel = reinterpret_cast<webrtc::DataChannelInterface *>(
+				env->GetLongField(channel, javaClass.nativeHandle));
+
+			if (dataChannel == nullptr) {
+				return;
+			}
+
+			auto counters = reinterpret_cast<RTCDataChannelCounters *>(
+				env->GetLongField(channel, javaClass.countersHandle));
+
+			out[kState] = static_cast<jlong>(dataChannel->state());
+			out[kBufferedAmount] = static_cast<jlong>(dataChannel->buffered_amount());
+
+			if (counters != nullptr) {
+				out[kMessagesSent] = static_cast<jlong>(counters->getMessagesSent());
+				out[kBytesSent] = static_cast<jlong>(counters->getBytesSent());
+				out[kMessagesReceived] = static_cast<jlong>(counters->getMessagesReceived());
+				out[kBytesReceived] = static_cast<jlong>(counters->getBytesReceived());
+				out[kId] = static_cast<jlong>(counters->getId(dataChannel));
+			}
+			else {
+				out[kId] = static_cast<jlong>(dataChannel->id());
+			}
+		}
+
+		JavaRTCDataChannelClass::JavaRTCDataChannelClass(JNIEnv * env)
+		{
+			jclass cls = FindClass(env, PKG"RTCDataChannel");
+
+			nativeHandle = GetFieldID(env, cls, "nativeHandle", "J");
+			countersHandle = GetFieldID(env, cls, "countersHandle", "J");
+		}
+	}
+}
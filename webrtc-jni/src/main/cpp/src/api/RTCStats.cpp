@@ -72,6 +72,13 @@ namespace jni
 		const std::map<std::string, uint8_t> typeMap = initTypeMap();
 
 
+		int toTypeIndex(const webrtc::RTCStats & stats)
+		{
+			auto result = typeMap.find(stats.type());
+
+			return result != typeMap.end() ? result->second : -1;
+		}
+
 		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::RTCStats & stats)
 		{
 			const auto javaClass = JavaClasses::get<JavaRTCStatsClass>(env);
@@ -91,9 +98,9 @@ namespace jni
 
 			JavaLocalRef<jobject> type = nullptr;
 
-			auto result = typeMap.find(stats.type());
-			if (result != typeMap.end()) {
-				type = jni::JavaEnums::toJava(env, static_cast<RTCStatsType>(result->second));
+			const int typeIndex = toTypeIndex(stats);
+			if (typeIndex >= 0) {
+				type = jni::JavaEnums::toJava(env, static_cast<RTCStatsType>(typeIndex));
 			}
 			else {
 				RTC_LOG(LS_WARNING) << "No Java Enum for '" << stats.type() << "' found";
@@ -0,0 +1,247 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "api/RTCStatsSnapshot.h"
+#include "api/RTCStats.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+#include "api/make_ref_counted.h"
+#include "api/stats/attribute.h"
+#include "api/stats/rtcstats_objects.h"
+
+#include <vector>
+
+namespace jni
+{
+	int RTCStatsStringTable::find(std::string_view value)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto result = indices.find(value);
+
+		return result != indices.end() ? result->second : -1;
+	}
+
+	std::optional<std::string> RTCStatsStringTable::get(int index)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (index < 0 || static_cast<size_t>(index) >= values.size()) {
+			return std::nullopt;
+		}
+
+		return values[index];
+	}
+
+	int RTCStatsStringTable::intern(std::string_view value)
+	{
+		auto result = indices.find(value);
+
+		if (result != indices.end()) {
+			return result->second;
+		}
+
+		const std::string & stored = values.emplace_back(value);
+		const int index = static_cast<int>(values.size() - 1);
+
+		indices.emplace(stored, index);
+
+		return index;
+	}
+
+	std::mutex & RTCStatsStringTable::getMutex()
+	{
+		return mutex;
+	}
+
+	namespace RTCStatsSnapshot
+	{
+		template <typename T>
+		static void internAttributeNames(RTCStatsStringTable & table)
+		{
+			const T stats("", webrtc::Timestamp::Zero());
+
+			for (const auto & attribute : stats.Attributes()) {
+				table.intern(attribute.name());
+			}
+		}
+
+		// Seeds the table with the attribute names of all stats types, so
+		// that IDs can be looked up before the first report is converted.
+		static RTCStatsStringTable & getAttributeTable()
+		{
+			// Never released, the IDs stay valid for the lifetime of the process.
+			static RTCStatsStringTable * table = [] {
+				auto * table = webrtc::make_ref_counted<RTCStatsStringTable>().release();
+
+				std::lock_guard<std::mutex> lock(table->getMutex());
+
+				internAttributeNames<webrtc::RTCCertificateStats>(*table);
+				internAttributeNames<webrtc::RTCCodecStats>(*table);
+				internAttributeNames<webrtc::RTCDataChannelStats>(*table);
+				internAttributeNames<webrtc::RTCIceCandidatePairStats>(*table);
+				internAttributeNames<webrtc::RTCLocalIceCandidateStats>(*table);
+				internAttributeNames<webrtc::RTCRemoteIceCandidateStats>(*table);
+				internAttributeNames<webrtc::RTCPeerConnectionStats>(*table);
+				internAttributeNames<webrtc::RTCInboundRtpStreamStats>(*table);
+				internAttributeNames<webrtc::RTCOutboundRtpStreamStats>(*table);
+				internAttributeNames<webrtc::RTCRemoteInboundRtpStreamStats>(*table);
+				internAttributeNames<webrtc::RTCRemoteOutboundRtpStreamStats>(*table);
+				internAttributeNames<webrtc::RTCAudioSourceStats>(*table);
+				internAttributeNames<webrtc::RTCVideoSourceStats>(*table);
+				internAttributeNames<webrtc::RTCTransportStats>(*table);
+				internAttributeNames<webrtc::RTCAudioPlayoutStats>(*table);
+
+				return table;
+			}();
+
+			return *table;
+		}
+
+		static JavaLocalRef<jbyteArray> toJavaArray(JNIEnv * env, const std::vector<jbyte> & values)
+		{
+			JavaLocalRef<jbyteArray> array(env, env->NewByteArray(static_cast<jsize>(values.size())));
+			env->SetByteArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+			return array;
+		}
+
+		static JavaLocalRef<jintArray> toJavaArray(JNIEnv * env, const std::vector<jint> & values)
+		{
+			JavaLocalRef<jintArray> array(env, env->NewIntArray(static_cast<jsize>(values.size())));
+			env->SetIntArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+			return array;
+		}
+
+		static JavaLocalRef<jlongArray> toJavaArray(JNIEnv * env, const std::vector<jlong> & values)
+		{
+			JavaLocalRef<jlongArray> array(env, env->NewLongArray(static_cast<jsize>(values.size())));
+			env->SetLongArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+			return array;
+		}
+
+		static JavaLocalRef<jdoubleArray> toJavaArray(JNIEnv * env, const std::vector<jdouble> & values)
+		{
+			JavaLocalRef<jdoubleArray> array(env, env->NewDoubleArray(static_cast<jsize>(values.size())));
+			env->SetDoubleArrayRegion(array, 0, static_cast<jsize>(values.size()), values.data());
+			return array;
+		}
+
+		int getAttributeId(std::string_view name)
+		{
+			return getAttributeTable().find(name);
+		}
+
+		std::optional<std::string> getAttributeName(int id)
+		{
+			return getAttributeTable().get(id);
+		}
+
+		JavaLocalRef<jobject> toJava(JNIEnv * env, const webrtc::scoped_refptr<const webrtc::RTCStatsReport> & report,
+			RTCStatsStringTable & idTable)
+		{
+			const auto javaClass = JavaClasses::get<JavaRTCStatsSnapshotClass>(env);
+			const size_t count = report->size();
+
+			RTCStatsStringTable & nameTable = getAttributeTable();
+
+			std::vector<jint> ids;
+			std::vector<jbyte> types;
+			std::vector<jlong> timestamps;
+			std::vector<jint> longOffsets;
+			std::vector<jint> longNames;
+			std::vector<jlong> longValues;
+			std::vector<jint> doubleOffsets;
+			std::vector<jint> doubleNames;
+			std::vector<jdouble> doubleValues;
+
+			ids.reserve(count);
+			types.reserve(count);
+			timestamps.reserve(count);
+			longOffsets.reserve(count + 1);
+			doubleOffsets.reserve(count + 1);
+
+			{
+				// Lock once for the whole report instead of once per attribute.
+				std::scoped_lock lock(idTable.getMutex(), nameTable.getMutex());
+
+				for (const auto & stats : *report) {
+					ids.push_back(idTable.intern(stats.id()));
+					types.push_back(static_cast<jbyte>(RTCStats::toTypeIndex(stats)));
+					timestamps.push_back(stats.timestamp().us());
+					longOffsets.push_back(static_cast<jint>(longValues.size()));
+					doubleOffsets.push_back(static_cast<jint>(doubleValues.size()));
+
+					for (const auto & attribute : stats.Attributes()) {
+						if (!attribute.has_value()) {
+							continue;
+						}
+
+						if (attribute.holds_alternative<double>()) {
+							doubleNames.push_back(nameTable.intern(attribute.name()));
+							doubleValues.push_back(attribute.get<double>());
+							continue;
+						}
+
+						jlong value;
+
+						if (attribute.holds_alternative<bool>()) {
+							value = attribute.get<bool>() ? 1 : 0;
+						}
+						else if (attribute.holds_alternative<int32_t>()) {
+							value = attribute.get<int32_t>();
+						}
+						else if (attribute.holds_alternative<uint32_t>()) {
+							value = attribute.get<uint32_t>();
+						}
+						else if (attribute.holds_alternative<int64_t>()) {
+							value = attribute.get<int64_t>();
+						}
+						else if (attribute.holds_alternative<uint64_t>()) {
+							// Keeps the bits, Java reads them as unsigned.
+							value = static_cast<jlong>(attribute.get<uint64_t>());
+						}
+						else {
+							continue;
+						}
+
+						longNames.push_back(nameTable.intern(attribute.name()));
+						longValues.push_back(value);
+					}
+				}
+			}
+
+			longOffsets.push_back(static_cast<jint>(longValues.size()));
+			doubleOffsets.push_back(static_cast<jint>(doubleValues.size()));
+
+			jobject obj = env->NewObject(javaClass->cls, javaClass->ctor,
+				report->timestamp().us(), toJavaArray(env, ids).get(),
+				toJavaArray(env, types).get(), toJavaArray(env, timestamps).get(),
+				toJavaArray(env, longOffsets).get(), toJavaArray(env, longNames).get(), toJavaArray(env, longValues).get(),
+				toJavaArray(env, doubleOffsets).get(), toJavaArray(env, doubleNames).get(), toJavaArray(env, doubleValues).get());
+
+			return JavaLocalRef<jobject>(env, obj);
+		}
+
+		JavaRTCStatsSnapshotClass::JavaRTCStatsSnapshotClass(JNIEnv * env)
+		{
+			cls = FindClass(env, PKG"RTCStatsSnapshot");
+
+			ctor = GetMethod(env, cls, "<init>", "(J[I[B[J[I[I[J[I[I[D)V");
+		}
+	}
+}
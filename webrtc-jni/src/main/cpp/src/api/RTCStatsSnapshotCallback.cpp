@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "api/RTCStatsSnapshotCallback.h"
+#include "JavaClasses.h"
+#include "JNI_WebRTC.h"
+
+namespace jni
+{
+	RTCStatsSnapshotCallback::RTCStatsSnapshotCallback(JNIEnv * env, const JavaGlobalRef<jobject> & callback,
+		webrtc::scoped_refptr<RTCStatsStringTable> idTable) :
+		callback(callback),
+		idTable(std::move(idTable)),
+		javaClass(JavaClasses::get<JavaRTCStatsSnapshotCallbackClass>(env))
+	{
+	}
+
+	void RTCStatsSnapshotCallback::OnStatsDelivered(const webrtc::scoped_refptr<const webrtc::RTCStatsReport> & report)
+	{
+		JNIEnv * env = AttachCurrentThread();
+
+		JavaLocalRef<jobject> snapshot = jni::RTCStatsSnapshot::toJava(env, report, *idTable);
+
+		env->CallVoidMethod(callback, javaClass->onStatsSnapshot, snapshot.get());
+
+		ExceptionCheck(env);
+	}
+
+	RTCStatsSnapshotCallback::JavaRTCStatsSnapshotCallbackClass::JavaRTCStatsSnapshotCallbackClass(JNIEnv * env)
+	{
+		jclass cls = FindClass(env, PKG"RTCStatsSnapshotCallback");
+
+		onStatsSnapshot = GetMethod(env, cls, "onStatsSnapshot", "(L" PKG "RTCStatsSnapshot;)V");
+	}
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioCaptureRing.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace jni
+{
+	AudioCaptureRing::AudioCaptureRing(size_t capacity) :
+		capacity(capacity),
+		memory(std::make_unique<uint8_t[]>(capacity)),
+		writePosition(0),
+		readPosition(0),
+		overrunCount(0),
+		sampleRate(0),
+		channels(0),
+		bytesPerSample(0)
+	{
+	}
+
+	int32_t AudioCaptureRing::RecordedDataIsAvailable(
+		const void * audioSamples,
+		const size_t nSamples,
+		const size_t nBytesPerSample,
+		const size_t nChannels,
+		const uint32_t samplesPerSec,
+		const uint32_t totalDelayMS,
+		const int32_t clockDrift,
+		const uint32_t currentMicLevel,
+		const bool keyPressed,
+		uint32_t & newMicLevel)
+	{
+		const size_t size = nSamples * nBytesPerSample;
+		const uint64_t write = writePosition.load(std::memory_order_relaxed);
+		const uint64_t read = readPosition.load(std::memory_order_acquire);
+
+		sampleRate.store(samplesPerSec, std::memory_order_relaxed);
+		channels.store(nChannels, std::memory_order_relaxed);
+		// WebRTC passes the size of an interleaved frame as bytes per sample.
+		bytesPerSample.store(nChannels > 0 ? nBytesPerSample / nChannels : nBytesPerSample, std::memory_order_relaxed);
+
+		if (capacity - static_cast<size_t>(write - read) < size) {
+			// The consumer is behind. Drop the whole chunk to keep the ring
+			// aligned to frames.
+			overrunCount.fetch_add(1, std::memory_order_relaxed);
+			return 0;
+		}
+
+		const uint8_t * src = static_cast<const uint8_t *>(audioSamples);
+		const size_t offset = static_cast<size_t>(write % capacity);
+		const size_t first = std::min(size, capacity - offset);
+
+		std::memcpy(memory.get() + offset, src, first);
+		std::memcpy(memory.get(), src + first, size - first);
+
+		writePosition.store(write + size, std::memory_order_release);
+
+		return 0;
+	}
+
+	uint8_t * AudioCaptureRing::data() const
+	{
+		return memory.get();
+	}
+
+	size_t AudioCaptureRing::getCapacity() const
+	{
+		return capacity;
+	}
+
+	uint64_t AudioCaptureRing::getWritePosition() const
+	{
+		return writePosition.load(std::memory_order_acquire);
+	}
+
+	uint64_t AudioCaptureRing::getReadPosition() const
+	{
+		return readPosition.load(std::memory_order_relaxed);
+	}
+
+	void AudioCaptureRing::setReadPosition(uint64_t position)
+	{
+		readPosition.store(position, std::memory_order_release);
+	}
+
+	uint64_t AudioCaptureRing::getOverrunCount() const
+	{
+		return overrunCount.load(std::memory_order_relaxed);
+	}
+
+	uint32_t AudioCaptureRing::getSampleRate() const
+	{
+		return sampleRate.load(std::memory_order_relaxed);
+	}
+
+	size_t AudioCaptureRing::getChannels() const
+	{
+		return channels.load(std::memory_order_relaxed);
+	}
+
+	size_t AudioCaptureRing::getBytesPerSample() const
+	{
+		return bytesPerSample.load(std::memory_order_relaxed);
+	}
+}
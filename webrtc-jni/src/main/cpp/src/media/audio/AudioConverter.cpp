@@ -16,185 +16,178 @@
 
 #include "media/audio/AudioConverter.h"
 
-#include <memory>
+#include "audio/utility/channel_mixing_matrix.h"
+#include "common_audio/include/audio_util.h"
+#include "rtc_base/checks.h"
 
-#include "audio/utility/channel_mixer.h"
-#include "common_audio/resampler/include/push_resampler.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 namespace jni
 {
-    class CopyConverter : public AudioConverter {
-        public:
-            CopyConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
-                : AudioConverter(srcFrames, srcChannels, dstFrames, dstChannels)
-            {
-            }
-
-            ~CopyConverter() override
-            {
-            }
-
-            void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) override {
-                checkSizes(srcSize, dstSize);
+    std::unique_ptr<AudioConverter> AudioConverter::create(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
+    {
+        return std::unique_ptr<AudioConverter>(new AudioConverter(srcFrames, srcChannels, dstFrames, dstChannels));
+    }
 
-                if (src != dst) {
-                    std::memcpy(dst, src, dstFrames * dstChannels * sizeof(int16_t));
-                }
-            }
-    };
+    AudioConverter::AudioConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels) :
+        srcFrames(srcFrames),
+        srcChannels(srcChannels),
+        dstFrames(dstFrames),
+        dstChannels(dstChannels),
+        planarChannels(std::min(srcChannels, dstChannels))
+    {
+        if (srcChannels != dstChannels) {
+            webrtc::ChannelLayout srcLayout = webrtc::GuessChannelLayout(static_cast<int>(srcChannels));
+            webrtc::ChannelLayout dstLayout = webrtc::GuessChannelLayout(static_cast<int>(dstChannels));
 
+            // Same coefficients as the webrtc::ChannelMixer.
+            webrtc::ChannelMixingMatrix matrixBuilder(srcLayout, static_cast<int>(srcChannels),
+                dstLayout, static_cast<int>(dstChannels));
 
-    class ChannelConverter : public AudioConverter {
-        public:
-            ChannelConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
-                : AudioConverter(srcFrames, srcChannels, dstFrames, dstChannels)
-            {
-                webrtc::ChannelLayout srcLayout = webrtc::GuessChannelLayout(static_cast<int>(srcChannels));
-                webrtc::ChannelLayout dstLayout = webrtc::GuessChannelLayout(static_cast<int>(dstChannels));
+            std::vector<std::vector<float>> matrix;
+            matrixBuilder.CreateTransformationMatrix(&matrix);
 
-                mixer = std::make_unique<webrtc::ChannelMixer>(srcLayout, dstLayout);
-                frame = std::make_unique<webrtc::AudioFrame>();
+            mixMatrix.reserve(dstChannels * srcChannels);
 
-                frame->samples_per_channel_ = srcFrames;
-                frame->num_channels_ = srcChannels;
+            for (const auto & row : matrix) {
+                mixMatrix.insert(mixMatrix.end(), row.begin(), row.end());
             }
+        }
 
-            ~ChannelConverter() override
-            {
+        if (srcFrames != dstFrames) {
+            for (size_t i = 0; i < planarChannels; ++i) {
+                resamplers.push_back(std::make_unique<webrtc::PushSincResampler>(srcFrames, dstFrames));
             }
 
-            void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) override {
-                checkSizes(srcSize, dstSize);
-
-                std::memcpy(frame->mutable_data(), src, srcFrames * srcChannels * sizeof(int16_t));
-
-                mixer->Transform(frame.get());
-
-                std::memcpy(dst, frame->data(), dstFrames * dstChannels * sizeof(int16_t));
-            }
+            dstPlanar.resize(planarChannels * dstFrames);
+        }
 
-        private:
-            std::unique_ptr<webrtc::ChannelMixer> mixer;
-            std::unique_ptr<webrtc::AudioFrame> frame;
-    };
+        if (!mixMatrix.empty() || !resamplers.empty()) {
+            srcPlanar.resize(planarChannels * srcFrames);
+        }
+    }
 
+    AudioConverter::~AudioConverter()
+    {
+    }
 
-    class ResampleConverter : public AudioConverter {
-        public:
-            ResampleConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
-                : AudioConverter(srcFrames, srcChannels, dstFrames, dstChannels)
-            {
-                resampler = std::make_unique<webrtc::PushResampler<int16_t>>(srcFrames, dstFrames, srcChannels);
-            }
+    void AudioConverter::convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize)
+    {
+        convertFrame(src, srcSize, dst, dstSize);
+    }
 
-            ~ResampleConverter() override
-            {
-            }
+    void AudioConverter::convert(const float * src, size_t srcSize, float * dst, size_t dstSize)
+    {
+        convertFrame(src, srcSize, dst, dstSize);
+    }
 
-            void convert(const int16_t * src, size_t srcSamplesPerChannel, int16_t * dst, size_t dstSamplesPerChannel) override {
-                webrtc::InterleavedView<const int16_t> srcView(src, srcSamplesPerChannel, srcChannels);
-                webrtc::InterleavedView<int16_t> dstView(dst, dstSamplesPerChannel, srcChannels);
+    template <typename T>
+    void AudioConverter::convertFrame(const T * src, size_t srcSize, T * dst, size_t dstSize)
+    {
+        checkSizes(srcSize, dstSize);
 
-                resampler->Resample(srcView, dstView);
+        if (srcPlanar.empty()) {
+            // Neither the rate nor the channels change.
+            if (src != dst) {
+                std::memcpy(dst, src, dstFrames * dstChannels * sizeof(T));
             }
+            return;
+        }
 
-        private:
-            std::unique_ptr<webrtc::PushResampler<int16_t>> resampler;
-    };
+        deinterleave(src);
 
+        if (resamplers.empty()) {
+            interleave(srcPlanar.data(), dst);
+        }
+        else {
+            resample();
+            interleave(dstPlanar.data(), dst);
+        }
+    }
 
-    class CompositionConverter : public AudioConverter {
-        public:
-            explicit CompositionConverter(std::vector<std::unique_ptr<AudioConverter>> converters_)
-                : converters(std::move(converters_))
-            {
-                RTC_CHECK_GE(converters.size(), 2);
+    template <typename T>
+    void AudioConverter::deinterleave(const T * src)
+    {
+        if (srcChannels <= dstChannels) {
+            // Up-mixing happens after resampling.
+            for (size_t c = 0; c < srcChannels; ++c) {
+                float * channel = srcPlanar.data() + c * srcFrames;
 
-                // We need an intermediate buffer after every converter.
-                for (auto it = converters.begin(); it != converters.end() - 1; ++it) {
-                    buffers.push_back(std::vector<int16_t>((*it)->getDstFrames() * (*it)->getDstChannels(), 0));
+                for (size_t i = 0; i < srcFrames; ++i) {
+                    channel[i] = static_cast<float>(src[i * srcChannels + c]);
                 }
             }
+            return;
+        }
 
-            ~CompositionConverter() override
-            {
-            }
-
-            void convert(const int16_t * src, size_t srcSize, int16_t * dst, size_t dstSize) override {
-                converters.front()->convert(src, srcSize, buffers.front().data(), buffers.front().size());
+        for (size_t c = 0; c < dstChannels; ++c) {
+            const float * coefficients = mixMatrix.data() + c * srcChannels;
+            float * channel = srcPlanar.data() + c * srcFrames;
 
-                for (size_t i = 2; i < converters.size(); ++i) {
-                    auto & src_buffer = buffers[i - 2];
-                    auto & dst_buffer = buffers[i - 1];
+            for (size_t i = 0; i < srcFrames; ++i) {
+                const T * frame = src + i * srcChannels;
+                float value = 0;
 
-                    converters[i]->convert(src_buffer.data(), src_buffer.size(), dst_buffer.data(), dst_buffer.size());
+                for (size_t j = 0; j < srcChannels; ++j) {
+                    value += coefficients[j] * static_cast<float>(frame[j]);
                 }
 
-                converters.back()->convert(buffers.back().data(), buffers.back().size(), dst, dstSize);
+                channel[i] = value;
             }
+        }
+    }
 
-        private:
-            std::vector<std::unique_ptr<AudioConverter>> converters;
-            std::vector<std::vector<int16_t>> buffers;
-    };
-
-
-	std::unique_ptr<AudioConverter> AudioConverter::create(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels)
-	{
-        std::unique_ptr<AudioConverter> converter;
-
-        if (srcChannels > dstChannels) {
-            if (srcFrames != dstFrames) {
-                std::vector<std::unique_ptr<AudioConverter>> converters;
-                converters.push_back(std::unique_ptr<AudioConverter>(new ChannelConverter(srcFrames, srcChannels, srcFrames, dstChannels)));
-                converters.push_back(std::unique_ptr<AudioConverter>(new ResampleConverter(srcFrames, dstChannels, dstFrames, dstChannels)));
+    void AudioConverter::resample()
+    {
+        for (size_t c = 0; c < planarChannels; ++c) {
+            resamplers[c]->Resample(srcPlanar.data() + c * srcFrames, srcFrames,
+                dstPlanar.data() + c * dstFrames, dstFrames);
+        }
+    }
 
-                converter.reset(new CompositionConverter(std::move(converters)));
+    template <typename T>
+    void AudioConverter::interleave(const float * planar, T * dst)
+    {
+        auto toSample = [](float value) -> T {
+            if constexpr (std::is_same_v<T, int16_t>) {
+                // Rounds and saturates.
+                return webrtc::FloatS16ToS16(value);
             }
             else {
-                converter.reset(new ChannelConverter(srcFrames, srcChannels, dstFrames, dstChannels));
+                return value;
             }
-        }
-        else if (srcChannels < dstChannels) {
-            if (srcFrames != dstFrames) {
-                std::vector<std::unique_ptr<AudioConverter>> converters;
-                converters.push_back(std::unique_ptr<AudioConverter>(new ResampleConverter(srcFrames, srcChannels, dstFrames, srcChannels)));
-                converters.push_back(std::unique_ptr<AudioConverter>(new ChannelConverter(dstFrames, srcChannels, dstFrames, dstChannels)));
+        };
 
-                converter.reset(new CompositionConverter(std::move(converters)));
-            }
-            else {
-                converter.reset(new ChannelConverter(srcFrames, srcChannels, dstFrames, dstChannels));
+        if (srcChannels >= dstChannels) {
+            for (size_t c = 0; c < dstChannels; ++c) {
+                const float * channel = planar + c * dstFrames;
+
+                for (size_t i = 0; i < dstFrames; ++i) {
+                    dst[i * dstChannels + c] = toSample(channel[i]);
+                }
             }
-        }
-        else if (srcFrames != dstFrames) {
-            converter.reset(new ResampleConverter(srcFrames, srcChannels, dstFrames, dstChannels));
-        }
-        else {
-            converter.reset(new CopyConverter(srcFrames, srcChannels, dstFrames, dstChannels));
+            return;
         }
 
-        return converter;
-	}
+        for (size_t c = 0; c < dstChannels; ++c) {
+            const float * coefficients = mixMatrix.data() + c * srcChannels;
 
-    AudioConverter::AudioConverter() :
-        srcFrames(0),
-        srcChannels(0),
-        dstFrames(0),
-        dstChannels(0)
-    {
-    }
+            for (size_t i = 0; i < dstFrames; ++i) {
+                float value = 0;
 
-    AudioConverter::AudioConverter(size_t srcFrames, size_t srcChannels, size_t dstFrames, size_t dstChannels) :
-        srcFrames(srcFrames),
-        srcChannels(srcChannels),
-        dstFrames(dstFrames),
-        dstChannels(dstChannels)
-    {
+                for (size_t j = 0; j < srcChannels; ++j) {
+                    value += coefficients[j] * planar[j * dstFrames + i];
+                }
+
+                dst[i * dstChannels + c] = toSample(value);
+            }
+        }
     }
 
     void AudioConverter::checkSizes(size_t srcSize, size_t dstCapacity) const {
         RTC_CHECK_EQ(srcSize, srcChannels * srcFrames);
         RTC_CHECK_GE(dstCapacity, dstChannels * dstFrames);
     }
-}
\ No newline at end of file
+}
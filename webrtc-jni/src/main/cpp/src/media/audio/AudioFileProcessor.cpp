@@ -0,0 +1,290 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioFileProcessor.h"
+#include "Exception.h"
+
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "common_audio/wav_file.h"
+#include "common_audio/wav_header.h"
+#include "rtc_base/system/file_wrapper.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	// The number of 10 ms frames read and written at once.
+	constexpr size_t kBlockFrames = 100;
+
+	// Reads a WAV header from a file. The WavReader aborts the process on
+	// malformed headers, so each file is validated with this reader first.
+	class WavHeaderFileReader : public webrtc::WavHeaderReader
+	{
+		public:
+			explicit WavHeaderFileReader(webrtc::FileWrapper * file) :
+				file(file),
+				position(0)
+			{
+			}
+
+			size_t Read(void * buffer, size_t bytes) override
+			{
+				const size_t read = file->Read(buffer, bytes);
+
+				position += read;
+
+				return read;
+			}
+
+			bool SeekForward(uint32_t bytes) override
+			{
+				if (!file->SeekRelativeTo(bytes)) {
+					return false;
+				}
+
+				position += bytes;
+
+				return true;
+			}
+
+			int64_t GetPosition() override
+			{
+				return position;
+			}
+
+		private:
+			webrtc::FileWrapper * file;
+			int64_t position;
+	};
+
+	static bool isValidWavFile(webrtc::FileWrapper & file)
+	{
+		WavHeaderFileReader headerReader(&file);
+
+		size_t channels = 0;
+		int sampleRate = 0;
+		webrtc::WavFormat format;
+		size_t bytesPerSample = 0;
+		size_t samples = 0;
+		int64_t dataStart = 0;
+
+		const bool valid = webrtc::ReadWavHeader(&headerReader, &channels, &sampleRate, &format,
+			&bytesPerSample, &samples, &dataStart);
+
+		// The WavReader reads the header again from the start.
+		return file.Rewind() && valid &&
+			(format == webrtc::WavFormat::kWavFormatPcm || format == webrtc::WavFormat::kWavFormatIeeeFloat);
+	}
+
+	AudioFileProcessor::AudioFileProcessor(const webrtc::Environment & environment,
+		const webrtc::AudioProcessing::Config & config, size_t workerCount) :
+		environment(environment),
+		config(config),
+		workerCount(std::max<size_t>(1, workerCount)),
+		nextFile(0),
+		cancelled(false)
+	{
+	}
+
+	AudioFileProcessor::~AudioFileProcessor()
+	{
+		cancel();
+		wait();
+	}
+
+	void AudioFileProcessor::start(const std::vector<std::string> & inputFiles,
+		const std::vector<std::string> & outputFiles)
+	{
+		std::lock_guard<std::mutex> threadLock(threadMutex);
+
+		if (!files.empty()) {
+			throw Exception("Audio file processor already started");
+		}
+
+		for (size_t i = 0; i < inputFiles.size(); ++i) {
+			auto file = std::make_unique<File>();
+			file->input = inputFiles[i];
+			file->output = outputFiles[i];
+			file->status = Status::kPending;
+			file->processedFrames = 0;
+			file->totalFrames = 0;
+
+			files.push_back(std::move(file));
+		}
+
+		const size_t count = std::min(workerCount, files.size());
+
+		for (size_t i = 0; i < count; ++i) {
+			workers.push_back(webrtc::PlatformThread::SpawnJoinable(
+				[this] {
+					run();
+				},
+				"webrtc_audio_file_processor_thread"));
+		}
+	}
+
+	void AudioFileProcessor::wait()
+	{
+		std::lock_guard<std::mutex> threadLock(threadMutex);
+
+		for (auto & worker : workers) {
+			worker.Finalize();
+		}
+
+		workers.clear();
+	}
+
+	void AudioFileProcessor::cancel()
+	{
+		cancelled = true;
+	}
+
+	size_t AudioFileProcessor::getFileCount() const
+	{
+		return files.size();
+	}
+
+	float AudioFileProcessor::getProgress(size_t index) const
+	{
+		const File & file = *files[index];
+
+		if (file.status == Status::kCompleted) {
+			return 1.f;
+		}
+
+		const uint64_t total = file.totalFrames;
+
+		return total > 0 ? static_cast<float>(file.processedFrames) / static_cast<float>(total) : 0.f;
+	}
+
+	AudioFileProcessor::Status AudioFileProcessor::getStatus(size_t index) const
+	{
+		return files[index]->status;
+	}
+
+	std::string AudioFileProcessor::getError(size_t index) const
+	{
+		const File & file = *files[index];
+
+		// The error is written before the status is published.
+		return file.status == Status::kFailed ? file.error : std::string();
+	}
+
+	void AudioFileProcessor::run()
+	{
+		size_t index;
+
+		while ((index = nextFile++) < files.size()) {
+			File & file = *files[index];
+
+			if (cancelled) {
+				file.error = "Processing cancelled";
+				file.status = Status::kFailed;
+				continue;
+			}
+
+			file.status = Status::kProcessing;
+
+			try {
+				processFile(file);
+
+				file.status = Status::kCompleted;
+			}
+			catch (const Exception & e) {
+				file.error = e.what();
+				file.status = Status::kFailed;
+			}
+		}
+	}
+
+	void AudioFileProcessor::processFile(File & file)
+	{
+		webrtc::FileWrapper inputFile = webrtc::FileWrapper::OpenReadOnly(file.input);
+
+		if (!inputFile.is_open()) {
+			throw Exception("Failed to open file: %s", file.input.c_str());
+		}
+
+		if (!isValidWavFile(inputFile)) {
+			throw Exception("Invalid WAV file: %s", file.input.c_str());
+		}
+
+		webrtc::WavReader reader(std::move(inputFile));
+
+		const int sampleRate = reader.sample_rate();
+		const size_t channels = reader.num_channels();
+
+		if (sampleRate % 100 != 0) {
+			throw Exception("Unsupported sample rate %d: %s", sampleRate, file.input.c_str());
+		}
+
+		webrtc::FileWrapper outputFile = webrtc::FileWrapper::OpenWriteOnly(file.output);
+
+		if (!outputFile.is_open()) {
+			throw Exception("Failed to open file: %s", file.output.c_str());
+		}
+
+		webrtc::WavWriter writer(std::move(outputFile), sampleRate, channels);
+
+		webrtc::scoped_refptr<webrtc::AudioProcessing> apm = webrtc::BuiltinAudioProcessingBuilder().Build(environment);
+
+		if (!apm) {
+			throw Exception("Create AudioProcessing failed");
+		}
+
+		apm->ApplyConfig(config);
+
+		const webrtc::StreamConfig streamConfig(sampleRate, channels);
+		const size_t frameSamples = streamConfig.num_samples();
+
+		std::vector<int16_t> block(frameSamples * kBlockFrames);
+
+		file.totalFrames = reader.num_samples() / channels;
+
+		while (!cancelled) {
+			const size_t samples = reader.ReadSamples(block.size(), block.data());
+
+			if (samples == 0) {
+				break;
+			}
+
+			// Pad the last frame with silence, only the read samples are written.
+			const size_t paddedSamples = (samples + frameSamples - 1) / frameSamples * frameSamples;
+
+			std::fill(block.begin() + samples, block.begin() + paddedSamples, 0);
+
+			for (size_t offset = 0; offset < paddedSamples; offset += frameSamples) {
+				int16_t * frame = block.data() + offset;
+
+				if (apm->ProcessStream(frame, streamConfig, streamConfig, frame) != webrtc::AudioProcessing::kNoError) {
+					throw Exception("Audio processing failed: %s", file.input.c_str());
+				}
+			}
+
+			writer.WriteSamples(block.data(), samples);
+
+			file.processedFrames += samples / channels;
+
+			if (samples < block.size()) {
+				break;
+			}
+		}
+
+		if (cancelled) {
+			throw Exception("Processing cancelled");
+		}
+	}
+}
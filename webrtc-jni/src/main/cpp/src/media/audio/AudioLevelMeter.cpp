@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioLevelMeter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace jni
+{
+	// The integration time of the loudness value.
+	constexpr float kLoudnessWindowSeconds = 0.4f;
+
+	// The loudness reported for digital silence.
+	constexpr float kMinLoudness = -100.f;
+
+	AudioLevelMeter::AudioLevelMeter() :
+		rms(0),
+		peak(0),
+		loudness(kMinLoudness),
+		meanSquare(0)
+	{
+	}
+
+	void AudioLevelMeter::OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels,
+		size_t frames)
+	{
+		const size_t count = frames * channels;
+
+		if (bitsPerSample != 16 || count == 0 || sampleRate <= 0) {
+			return;
+		}
+
+		const int16_t * samples = static_cast<const int16_t *>(data);
+
+		// Plain reductions without branches, which the compiler vectorizes.
+		int64_t sum = 0;
+		int32_t max = 0;
+
+		for (size_t i = 0; i < count; ++i) {
+			const int32_t sample = samples[i];
+
+			sum += sample * sample;
+			max = std::max(max, std::abs(sample));
+		}
+
+		const float scale = 1.f / 32768.f;
+		const float chunkMeanSquare = static_cast<float>(sum) / static_cast<float>(count) * scale * scale;
+		const float chunkPeak = std::min(1.f, static_cast<float>(max) * scale);
+
+		// Exponential integration over the loudness window.
+		const float duration = static_cast<float>(frames) / static_cast<float>(sampleRate);
+		const float alpha = 1.f - std::exp(-duration / kLoudnessWindowSeconds);
+
+		meanSquare += alpha * (chunkMeanSquare - meanSquare);
+
+		rms.store(std::sqrt(chunkMeanSquare), std::memory_order_relaxed);
+		loudness.store(std::max(kMinLoudness, 10.f * std::log10(meanSquare + 1e-12f)), std::memory_order_relaxed);
+
+		float current = peak.load(std::memory_order_relaxed);
+
+		while (current < chunkPeak && !peak.compare_exchange_weak(current, chunkPeak, std::memory_order_relaxed)) {
+		}
+	}
+
+	float AudioLevelMeter::getRms() const
+	{
+		return rms.load(std::memory_order_relaxed);
+	}
+
+	float AudioLevelMeter::takePeak()
+	{
+		return peak.exchange(0, std::memory_order_relaxed);
+	}
+
+	float AudioLevelMeter::getLoudness() const
+	{
+		return loudness.load(std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioPacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace jni
+{
+	AudioPacer::AudioPacer(int sampleRate, size_t channels, size_t capacityFrames,
+		std::shared_ptr<SyncClock> clock, FrameCallback callback) :
+		sampleRate(sampleRate),
+		channels(channels),
+		framesIn10MS(static_cast<size_t>(sampleRate / 100)),
+		clock(clock),
+		callback(std::move(callback)),
+		ring(std::max(capacityFrames, framesIn10MS) * channels),
+		readIndex(0),
+		bufferedSamples(0),
+		primed(false),
+		frame(framesIn10MS * channels),
+		nextFrameUs(0),
+		running(false),
+		underrunCount(0),
+		overrunCount(0)
+	{
+	}
+
+	AudioPacer::~AudioPacer()
+	{
+		stop();
+	}
+
+	void AudioPacer::start()
+	{
+		if (running.exchange(true)) {
+			return;
+		}
+
+		nextFrameUs = 0;
+
+		thread = webrtc::PlatformThread::SpawnJoinable(
+			[this] {
+				while (process()) {
+				}
+			},
+			"webrtc_audio_pacer_thread",
+			webrtc::ThreadAttributes().SetPriority(webrtc::ThreadPriority::kRealtime));
+	}
+
+	void AudioPacer::stop()
+	{
+		if (!running.exchange(false)) {
+			return;
+		}
+
+		if (!thread.empty()) {
+			thread.Finalize();
+		}
+	}
+
+	size_t AudioPacer::write(const int16_t * data, size_t frames)
+	{
+		webrtc::MutexLock lock(&mutex);
+
+		const size_t capacity = ring.size();
+		const size_t free = capacity - bufferedSamples;
+		const size_t samples = std::min(frames * channels, free - free % channels);
+
+		if (samples < frames * channels) {
+			overrunCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		size_t writeIndex = (readIndex + bufferedSamples) % capacity;
+		size_t remaining = samples;
+
+		while (remaining > 0) {
+			const size_t count = std::min(remaining, capacity - writeIndex);
+
+			std::memcpy(ring.data() + writeIndex, data, count * sizeof(int16_t));
+
+			data += count;
+			remaining -= count;
+			writeIndex = (writeIndex + count) % capacity;
+		}
+
+		bufferedSamples += samples;
+		primed = primed || samples > 0;
+
+		return samples / channels;
+	}
+
+	int AudioPacer::getSampleRate() const
+	{
+		return sampleRate;
+	}
+
+	size_t AudioPacer::getChannels() const
+	{
+		return channels;
+	}
+
+	size_t AudioPacer::getCapacityFrames() const
+	{
+		return ring.size() / channels;
+	}
+
+	size_t AudioPacer::getBufferedFrames() const
+	{
+		webrtc::MutexLock lock(&mutex);
+
+		return bufferedSamples / channels;
+	}
+
+	uint64_t AudioPacer::getUnderrunCount() const
+	{
+		return underrunCount.load(std::memory_order_relaxed);
+	}
+
+	uint64_t AudioPacer::getOverrunCount() const
+	{
+		return overrunCount.load(std::memory_order_relaxed);
+	}
+
+	bool AudioPacer::process()
+	{
+		if (!running.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		const int64_t now = clock->GetTimestampUs();
+
+		// Seed the grid on the first tick.
+		if (nextFrameUs == 0) {
+			nextFrameUs = now;
+		}
+
+		if (now >= nextFrameUs) {
+			emitFrame();
+
+			// Advance by a fixed 10 ms so that wake-up latency does not
+			// accumulate into the frame period.
+			nextFrameUs += 10000;
+
+			// Resync instead of bursting frames after falling far behind.
+			if (nextFrameUs < now - 100000) {
+				nextFrameUs = now;
+			}
+		}
+
+		// Sleep with microsecond resolution. Whole milliseconds would leave
+		// the thread spinning for the sub-millisecond rest of each period.
+		const int64_t sleepUs = nextFrameUs - clock->GetTimestampUs();
+
+		if (sleepUs > 0) {
+			std::this_thread::sleep_for(std::chrono::microseconds(sleepUs));
+		}
+
+		return true;
+	}
+
+	void AudioPacer::emitFrame()
+	{
+		const size_t frameSamples = frame.size();
+		bool emit = false;
+
+		{
+			webrtc::MutexLock lock(&mutex);
+
+			const size_t capacity = ring.size();
+			const size_t samples = std::min(frameSamples, bufferedSamples);
+			size_t remaining = samples;
+			size_t offset = 0;
+
+			while (remaining > 0) {
+				const size_t count = std::min(remaining, capacity - readIndex);
+
+				std::memcpy(frame.data() + offset, ring.data() + readIndex, count * sizeof(int16_t));
+
+				offset += count;
+				remaining -= count;
+				readIndex = (readIndex + count) % capacity;
+			}
+
+			bufferedSamples -= samples;
+
+			if (samples < frameSamples) {
+				std::memset(frame.data() + samples, 0, (frameSamples - samples) * sizeof(int16_t));
+
+				if (primed) {
+					underrunCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+			emit = primed;
+		}
+
+		if (emit) {
+			callback(frame.data(), framesIn10MS);
+		}
+	}
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioPlaybackRing.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace jni
+{
+	AudioPlaybackRing::AudioPlaybackRing(size_t capacity, size_t prefill) :
+		capacity(capacity),
+		prefill(prefill),
+		memory(std::make_unique<uint8_t[]>(capacity)),
+		writePosition(0),
+		readPosition(0),
+		primed(false),
+		underrunCount(0),
+		sampleRate(0),
+		channels(0)
+	{
+	}
+
+	int32_t AudioPlaybackRing::NeedMorePlayData(
+		const size_t nSamples,
+		const size_t nBytesPerSample,
+		const size_t nChannels,
+		const uint32_t samplesPerSec,
+		void * audioSamples,
+		size_t & nSamplesOut,
+		int64_t * elapsed_time_ms,
+		int64_t * ntp_time_ms)
+	{
+		*elapsed_time_ms = 0;
+		*ntp_time_ms = 0;
+
+		sampleRate.store(samplesPerSec, std::memory_order_relaxed);
+		channels.store(nChannels, std::memory_order_relaxed);
+
+		uint8_t * dst = static_cast<uint8_t *>(audioSamples);
+		const size_t size = nSamples * nBytesPerSample;
+		const uint64_t read = readPosition.load(std::memory_order_relaxed);
+		const uint64_t write = writePosition.load(std::memory_order_acquire);
+		const size_t available = static_cast<size_t>(write - read);
+
+		nSamplesOut = nSamples;
+
+		if (!primed) {
+			if (available < std::max(prefill, size)) {
+				std::memset(dst, 0, size);
+				return 0;
+			}
+
+			primed = true;
+		}
+
+		const size_t count = std::min(size, available);
+		const size_t offset = static_cast<size_t>(read % capacity);
+		const size_t first = std::min(count, capacity - offset);
+
+		std::memcpy(dst, memory.get() + offset, first);
+		std::memcpy(dst + first, memory.get(), count - first);
+
+		if (count < size) {
+			// The writer fell behind. Pad with silence and buffer up to the
+			// prefill level again before resuming.
+			std::memset(dst + count, 0, size - count);
+
+			underrunCount.fetch_add(1, std::memory_order_relaxed);
+			primed = false;
+		}
+
+		readPosition.store(read + count, std::memory_order_release);
+
+		return 0;
+	}
+
+	uint8_t * AudioPlaybackRing::data() const
+	{
+		return memory.get();
+	}
+
+	size_t AudioPlaybackRing::getCapacity() const
+	{
+		return capacity;
+	}
+
+	size_t AudioPlaybackRing::getPrefill() const
+	{
+		return prefill;
+	}
+
+	uint64_t AudioPlaybackRing::getWritePosition() const
+	{
+		return writePosition.load(std::memory_order_relaxed);
+	}
+
+	void AudioPlaybackRing::setWritePosition(uint64_t position)
+	{
+		writePosition.store(position, std::memory_order_release);
+	}
+
+	uint64_t AudioPlaybackRing::getReadPosition() const
+	{
+		return readPosition.load(std::memory_order_acquire);
+	}
+
+	uint64_t AudioPlaybackRing::getUnderrunCount() const
+	{
+		return underrunCount.load(std::memory_order_relaxed);
+	}
+
+	uint32_t AudioPlaybackRing::getSampleRate() const
+	{
+		return sampleRate.load(std::memory_order_relaxed);
+	}
+
+	size_t AudioPlaybackRing::getChannels() const
+	{
+		return channels.load(std::memory_order_relaxed);
+	}
+}
@@ -26,8 +26,37 @@ namespace jni
 {
 	namespace AudioProcessing
 	{
-		void updateStats(const webrtc::AudioProcessingStats & stats, JNIEnv * env, const JavaRef<jobject> & javaType)
+		static void setTiming(JNIEnv * env, JavaObject & statsObj, const InstrumentedAudioProcessing::Timing & timing,
+			jfieldID frames, jfieldID framesPerSecond, jfieldID timeMean, jfieldID timeMax, jfieldID histogram)
 		{
+			const double mean = timing.calls > 0 ? static_cast<double>(timing.totalMicros) / timing.calls : 0;
+
+			statsObj.setLong(frames, static_cast<jlong>(timing.calls));
+			statsObj.setDouble(framesPerSecond, timing.callsPerSecond);
+			statsObj.setDouble(timeMean, mean);
+			statsObj.setLong(timeMax, static_cast<jlong>(timing.maxMicros));
+
+			JavaLocalRef<jobject> histogramArray = statsObj.getObject(histogram);
+			jlong values[InstrumentedAudioProcessing::kBucketCount];
+
+			for (size_t i = 0; i < InstrumentedAudioProcessing::kBucketCount; ++i) {
+				values[i] = static_cast<jlong>(timing.histogram[i]);
+			}
+
+			env->SetLongArrayRegion(static_cast<jlongArray>(histogramArray.get()), 0,
+				static_cast<jsize>(InstrumentedAudioProcessing::kBucketCount), values);
+		}
+
+		void updateStats(InstrumentedAudioProcessing * apm, JNIEnv * env, const JavaRef<jobject> & javaType)
+		{
+			const webrtc::AudioProcessingStats stats = apm->GetStatistics();
+			const webrtc::AudioProcessing::Config config = apm->GetConfig();
+
+			InstrumentedAudioProcessing::Timing capture;
+			InstrumentedAudioProcessing::Timing render;
+
+			apm->getTimings(capture, render);
+
 			const auto javaClass = JavaClasses::get<JavaAudioProcessingClass>(env);
 			const auto javaStatsClass = JavaClasses::get<AudioProcessingStats::JavaAudioProcessingStatsClass>(env);
 
@@ -42,6 +71,18 @@ namespace jni
 			statsObj.setInt(javaStatsClass->delayStandardDeviationMs, stats.delay_standard_deviation_ms.value_or(0));
 			statsObj.setDouble(javaStatsClass->residualEchoLikelihood, stats.residual_echo_likelihood.value_or(0));
 			statsObj.setDouble(javaStatsClass->residualEchoLikelihoodRecentMax, stats.residual_echo_likelihood_recent_max.value_or(0));
+
+			setTiming(env, statsObj, capture, javaStatsClass->captureFrames, javaStatsClass->captureFramesPerSecond,
+				javaStatsClass->captureTimeMeanUs, javaStatsClass->captureTimeMaxUs, javaStatsClass->captureTimeHistogram);
+			setTiming(env, statsObj, render, javaStatsClass->renderFrames, javaStatsClass->renderFramesPerSecond,
+				javaStatsClass->renderTimeMeanUs, javaStatsClass->renderTimeMaxUs, javaStatsClass->renderTimeHistogram);
+
+			statsObj.setBoolean(javaStatsClass->echoCancellerEnabled, config.echo_canceller.enabled);
+			statsObj.setBoolean(javaStatsClass->noiseSuppressionEnabled, config.noise_suppression.enabled);
+			statsObj.setBoolean(javaStatsClass->gainControllerEnabled, config.gain_controller1.enabled);
+			statsObj.setBoolean(javaStatsClass->gainControllerDigitalEnabled, config.gain_controller2.enabled);
+			statsObj.setBoolean(javaStatsClass->highPassFilterEnabled, config.high_pass_filter.enabled);
+			statsObj.setBoolean(javaStatsClass->captureLevelAdjustmentEnabled, config.capture_level_adjustment.enabled);
 		}
 
 		JavaAudioProcessingClass::JavaAudioProcessingClass(JNIEnv * env)
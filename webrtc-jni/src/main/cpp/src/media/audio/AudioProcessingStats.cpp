@@ -37,6 +37,22 @@ namespace jni
 			delayStandardDeviationMs = GetFieldID(env, cls, "delayStandardDeviationMs", "I");
 			residualEchoLikelihood = GetFieldID(env, cls, "residualEchoLikelihood", "D");
 			residualEchoLikelihoodRecentMax = GetFieldID(env, cls, "residualEchoLikelihoodRecentMax", "D");
+			captureFrames = GetFieldID(env, cls, "captureFrames", "J");
+			captureFramesPerSecond = GetFieldID(env, cls, "captureFramesPerSecond", "D");
+			captureTimeMeanUs = GetFieldID(env, cls, "captureTimeMeanUs", "D");
+			captureTimeMaxUs = GetFieldID(env, cls, "captureTimeMaxUs", "J");
+			captureTimeHistogram = GetFieldID(env, cls, "captureTimeHistogram", "[J");
+			renderFrames = GetFieldID(env, cls, "renderFrames", "J");
+			renderFramesPerSecond = GetFieldID(env, cls, "renderFramesPerSecond", "D");
+			renderTimeMeanUs = GetFieldID(env, cls, "renderTimeMeanUs", "D");
+			renderTimeMaxUs = GetFieldID(env, cls, "renderTimeMaxUs", "J");
+			renderTimeHistogram = GetFieldID(env, cls, "renderTimeHistogram", "[J");
+			echoCancellerEnabled = GetFieldID(env, cls, "echoCancellerEnabled", "Z");
+			noiseSuppressionEnabled = GetFieldID(env, cls, "noiseSuppressionEnabled", "Z");
+			gainControllerEnabled = GetFieldID(env, cls, "gainControllerEnabled", "Z");
+			gainControllerDigitalEnabled = GetFieldID(env, cls, "gainControllerDigitalEnabled", "Z");
+			highPassFilterEnabled = GetFieldID(env, cls, "highPassFilterEnabled", "Z");
+			captureLevelAdjustmentEnabled = GetFieldID(env, cls, "captureLevelAdjustmentEnabled", "Z");
 		}
 	}
 }
\ No newline at end of file
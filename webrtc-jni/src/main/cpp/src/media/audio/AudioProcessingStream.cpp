@@ -0,0 +1,290 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioProcessingStream.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	AudioProcessingStream::AudioProcessingStream()
+	{
+	}
+
+	bool AudioProcessingStream::canRemix(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output)
+	{
+		const size_t inChannels = input.num_channels();
+		const size_t outChannels = output.num_channels();
+
+		// Same layouts, mono input and mono output are not remixed.
+		if (inChannels == outChannels || inChannels == 1 || outChannels == 1) {
+			return true;
+		}
+
+		return std::max(inChannels, outChannels) <= kMaxRemixChannels;
+	}
+
+	bool AudioProcessingStream::setStreamConfig(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output)
+	{
+		if (!canRemix(input, output)) {
+			return false;
+		}
+
+		configure(forward, input, output);
+
+		return true;
+	}
+
+	bool AudioProcessingStream::setReverseStreamConfig(const webrtc::StreamConfig & input, const webrtc::StreamConfig & output)
+	{
+		if (!canRemix(input, output)) {
+			return false;
+		}
+
+		configure(backward, input, output);
+
+		return true;
+	}
+
+	int AudioProcessingStream::processStream(webrtc::AudioProcessing * apm, const int16_t * src, int16_t * dst, size_t frames)
+	{
+		return process(apm, forward, false, src, dst, frames);
+	}
+
+	int AudioProcessingStream::processReverseStream(webrtc::AudioProcessing * apm, const int16_t * src, int16_t * dst, size_t frames)
+	{
+		return process(apm, backward, true, src, dst, frames);
+	}
+
+	int AudioProcessingStream::processStream(webrtc::AudioProcessing * apm, const float * src, float * dst, size_t frames, bool planar)
+	{
+		return process(apm, forward, false, src, dst, frames, planar);
+	}
+
+	int AudioProcessingStream::processReverseStream(webrtc::AudioProcessing * apm, const float * src, float * dst, size_t frames, bool planar)
+	{
+		return process(apm, backward, true, src, dst, frames, planar);
+	}
+
+	int AudioProcessingStream::processFrame(webrtc::AudioProcessing * apm, const webrtc::StreamConfig & input,
+		const webrtc::StreamConfig & output, const int16_t * src, int16_t * dst, bool reverse)
+	{
+		Direction & direction = reverse ? backwardFrame : forwardFrame;
+
+		std::lock_guard<std::mutex> lock(direction.mutex);
+
+		if (!direction.configured || direction.input != input || direction.output != output) {
+			if (!canRemix(input, output)) {
+				return webrtc::AudioProcessing::kBadNumberChannelsError;
+			}
+
+			configure(direction, input, output);
+		}
+
+		return processFrame(apm, direction, reverse, src, dst);
+	}
+
+	size_t AudioProcessingStream::getInputSamples(bool reverse) const
+	{
+		const Direction & direction = reverse ? backward : forward;
+
+		return direction.input.num_samples();
+	}
+
+	size_t AudioProcessingStream::getOutputSamples(bool reverse) const
+	{
+		const Direction & direction = reverse ? backward : forward;
+
+		return direction.output.num_samples();
+	}
+
+	void AudioProcessingStream::configure(Direction & direction, const webrtc::StreamConfig & input,
+		const webrtc::StreamConfig & output)
+	{
+		const size_t inChannels = input.num_channels();
+		const size_t outChannels = output.num_channels();
+
+		direction.input = input;
+		direction.output = output;
+		direction.configured = true;
+		direction.processInput = input;
+		direction.processOutput = output;
+		direction.mixer.reset();
+
+		if (inChannels == outChannels || outChannels == 1) {
+			// The APM down-mixes to mono itself.
+			direction.remix = Remix::kNone;
+			direction.buffer.clear();
+		}
+		else if (inChannels == 1) {
+			// Process mono and duplicate the result into all channels.
+			direction.remix = Remix::kDuplicate;
+			direction.processOutput.set_num_channels(1);
+			direction.buffer.resize(direction.processOutput.num_samples());
+		}
+		else if (inChannels > outChannels) {
+			direction.remix = Remix::kBefore;
+			direction.processInput.set_num_channels(outChannels);
+			direction.mixer = AudioConverter::create(input.num_frames(), inChannels, input.num_frames(), outChannels);
+			direction.buffer.resize(direction.processInput.num_samples());
+		}
+		else {
+			direction.remix = Remix::kAfter;
+			direction.processOutput.set_num_channels(inChannels);
+			direction.mixer = AudioConverter::create(output.num_frames(), inChannels, output.num_frames(), outChannels);
+			direction.buffer.resize(direction.processOutput.num_samples());
+		}
+
+		direction.srcChannels.resize(input.num_channels());
+		direction.dstChannels.resize(output.num_channels());
+		// Allocated on first use of the interleaved float interface.
+		direction.planarInput.clear();
+		direction.planarOutput.clear();
+	}
+
+	int AudioProcessingStream::process(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+		const int16_t * src, int16_t * dst, size_t frames)
+	{
+		if (!direction.configured) {
+			return webrtc::AudioProcessing::kBadParameterError;
+		}
+
+		const size_t srcSamples = direction.input.num_samples();
+		const size_t dstSamples = direction.output.num_samples();
+
+		for (size_t i = 0; i < frames; i++) {
+			const int result = processFrame(apm, direction, reverse, src + i * srcSamples, dst + i * dstSamples);
+
+			if (result != webrtc::AudioProcessing::kNoError) {
+				return result;
+			}
+		}
+
+		return webrtc::AudioProcessing::kNoError;
+	}
+
+	int AudioProcessingStream::processFrame(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+		const int16_t * src, int16_t * dst)
+	{
+		const webrtc::StreamConfig & srcConfig = direction.processInput;
+		const webrtc::StreamConfig & dstConfig = direction.processOutput;
+		int16_t * buffer = direction.buffer.data();
+
+		if (direction.remix == Remix::kBefore) {
+			direction.mixer->convert(src, direction.input.num_samples(), buffer, direction.buffer.size());
+			src = buffer;
+		}
+
+		int16_t * out = direction.remix == Remix::kNone || direction.remix == Remix::kBefore ? dst : buffer;
+
+		const int result = reverse
+			? apm->ProcessReverseStream(src, srcConfig, dstConfig, out)
+			: apm->ProcessStream(src, srcConfig, dstConfig, out);
+
+		if (result != webrtc::AudioProcessing::kNoError) {
+			return result;
+		}
+
+		if (direction.remix == Remix::kDuplicate) {
+			const size_t channels = direction.output.num_channels();
+			const size_t frames = direction.output.num_frames();
+
+			// Channel-outer, so that the inner loop is a plain strided copy.
+			for (size_t c = 0; c < channels; c++) {
+				int16_t * channel = dst + c;
+
+				for (size_t j = 0; j < frames; j++) {
+					channel[j * channels] = buffer[j];
+				}
+			}
+		}
+		else if (direction.remix == Remix::kAfter) {
+			direction.mixer->convert(buffer, direction.buffer.size(), dst, direction.output.num_samples());
+		}
+
+		return webrtc::AudioProcessing::kNoError;
+	}
+
+	int AudioProcessingStream::process(webrtc::AudioProcessing * apm, Direction & direction, bool reverse,
+		const float * src, float * dst, size_t frames, bool planar)
+	{
+		if (!direction.configured) {
+			return webrtc::AudioProcessing::kBadParameterError;
+		}
+
+		const webrtc::StreamConfig & srcConfig = direction.input;
+		const webrtc::StreamConfig & dstConfig = direction.output;
+		const size_t srcChannels = srcConfig.num_channels();
+		const size_t dstChannels = dstConfig.num_channels();
+		const size_t srcFrames = srcConfig.num_frames();
+		const size_t dstFrames = dstConfig.num_frames();
+		const size_t srcSamples = srcConfig.num_samples();
+		const size_t dstSamples = dstConfig.num_samples();
+
+		if (!planar && direction.planarInput.empty()) {
+			direction.planarInput.resize(srcSamples);
+			direction.planarOutput.resize(dstSamples);
+		}
+
+		for (size_t i = 0; i < frames; i++) {
+			const float * srcFrame = src + i * srcSamples;
+			float * dstFrame = dst + i * dstSamples;
+
+			const float * srcPlanar = srcFrame;
+			float * dstPlanar = dstFrame;
+
+			if (!planar) {
+				srcPlanar = direction.planarInput.data();
+				dstPlanar = direction.planarOutput.data();
+
+				for (size_t c = 0; c < srcChannels; c++) {
+					float * channel = direction.planarInput.data() + c * srcFrames;
+
+					for (size_t j = 0; j < srcFrames; j++) {
+						channel[j] = srcFrame[j * srcChannels + c];
+					}
+				}
+			}
+
+			for (size_t c = 0; c < srcChannels; c++) {
+				direction.srcChannels[c] = srcPlanar + c * srcFrames;
+			}
+			for (size_t c = 0; c < dstChannels; c++) {
+				direction.dstChannels[c] = dstPlanar + c * dstFrames;
+			}
+
+			const int result = reverse
+				? apm->ProcessReverseStream(direction.srcChannels.data(), srcConfig, dstConfig, direction.dstChannels.data())
+				: apm->ProcessStream(direction.srcChannels.data(), srcConfig, dstConfig, direction.dstChannels.data());
+
+			if (result != webrtc::AudioProcessing::kNoError) {
+				return result;
+			}
+
+			if (!planar) {
+				for (size_t c = 0; c < dstChannels; c++) {
+					const float * channel = direction.planarOutput.data() + c * dstFrames;
+
+					for (size_t j = 0; j < dstFrames; j++) {
+						dstFrame[j * dstChannels + c] = channel[j];
+					}
+				}
+			}
+		}
+
+		return webrtc::AudioProcessing::kNoError;
+	}
+}
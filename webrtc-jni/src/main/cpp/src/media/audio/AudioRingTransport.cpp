@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioRingTransport.h"
+
+#include <cstring>
+
+namespace jni
+{
+	AudioRingTransport::AudioRingTransport() :
+		captureRing(nullptr),
+		playbackRing(nullptr)
+	{
+	}
+
+	void AudioRingTransport::setCaptureRing(AudioCaptureRing * ring)
+	{
+		captureRing.store(ring, std::memory_order_release);
+	}
+
+	void AudioRingTransport::setPlaybackRing(AudioPlaybackRing * ring)
+	{
+		playbackRing.store(ring, std::memory_order_release);
+	}
+
+	bool AudioRingTransport::isEmpty() const
+	{
+		return captureRing.load(std::memory_order_acquire) == nullptr &&
+			playbackRing.load(std::memory_order_acquire) == nullptr;
+	}
+
+	int32_t AudioRingTransport::RecordedDataIsAvailable(
+		const void * audioSamples,
+		const size_t nSamples,
+		const size_t nBytesPerSample,
+		const size_t nChannels,
+		const uint32_t samplesPerSec,
+		const uint32_t totalDelayMS,
+		const int32_t clockDrift,
+		const uint32_t currentMicLevel,
+		const bool keyPressed,
+		uint32_t & newMicLevel)
+	{
+		AudioCaptureRing * ring = captureRing.load(std::memory_order_acquire);
+
+		if (ring == nullptr) {
+			return 0;
+		}
+
+		return ring->RecordedDataIsAvailable(audioSamples, nSamples, nBytesPerSample, nChannels,
+			samplesPerSec, totalDelayMS, clockDrift, currentMicLevel, keyPressed, newMicLevel);
+	}
+
+	int32_t AudioRingTransport::NeedMorePlayData(
+		const size_t nSamples,
+		const size_t nBytesPerSample,
+		const size_t nChannels,
+		const uint32_t samplesPerSec,
+		void * audioSamples,
+		size_t & nSamplesOut,
+		int64_t * elapsed_time_ms,
+		int64_t * ntp_time_ms)
+	{
+		AudioPlaybackRing * ring = playbackRing.load(std::memory_order_acquire);
+
+		if (ring == nullptr) {
+			// Play silence while only capturing.
+			std::memset(audioSamples, 0, nSamples * nBytesPerSample);
+
+			nSamplesOut = nSamples;
+			*elapsed_time_ms = 0;
+			*ntp_time_ms = 0;
+
+			return 0;
+		}
+
+		return ring->NeedMorePlayData(nSamples, nBytesPerSample, nChannels, samplesPerSec,
+			audioSamples, nSamplesOut, elapsed_time_ms, ntp_time_ms);
+	}
+
+	void AudioRingTransport::PullRenderData(
+		int bits_per_sample,
+		int sample_rate,
+		size_t number_of_channels,
+		size_t number_of_frames,
+		void * audio_data,
+		int64_t * elapsed_time_ms,
+		int64_t * ntp_time_ms)
+	{
+	}
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/AudioTrackRecorder.h"
+#include "Exception.h"
+
+#include "api/units/time_delta.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/synchronization/mutex.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace jni
+{
+	// Shared writer thread of all recorders. One thread drains every ring, so
+	// the thread count stays constant with hundreds of recordings. The thread
+	// runs only while recorders are registered.
+	class AudioTrackRecorderWriter
+	{
+		public:
+			static AudioTrackRecorderWriter & instance()
+			{
+				// Intentionally leaked to avoid destruction order issues at exit.
+				static AudioTrackRecorderWriter * writer = new AudioTrackRecorderWriter();
+				return *writer;
+			}
+
+			void add(AudioTrackRecorder * recorder)
+			{
+				std::lock_guard<std::mutex> threadLock(threadMutex);
+
+				{
+					webrtc::MutexLock lock(&mutex);
+
+					recorders.push_back(recorder);
+
+					if (running) {
+						return;
+					}
+					running = true;
+				}
+
+				thread = webrtc::PlatformThread::SpawnJoinable(
+					[this] {
+						while (process()) {
+						}
+					},
+					"webrtc_audio_recorder_thread");
+			}
+
+			// Once this returns, the recorder is not drained anymore.
+			void remove(AudioTrackRecorder * recorder)
+			{
+				std::lock_guard<std::mutex> threadLock(threadMutex);
+
+				{
+					webrtc::MutexLock lock(&mutex);
+
+					recorders.erase(std::remove(recorders.begin(), recorders.end(), recorder), recorders.end());
+
+					if (!recorders.empty() || !running) {
+						return;
+					}
+					running = false;
+				}
+
+				wakeUp.Set();
+
+				if (!thread.empty()) {
+					thread.Finalize();
+				}
+			}
+
+		private:
+			AudioTrackRecorderWriter() :
+				running(false)
+			{
+			}
+
+			bool process()
+			{
+				// Batch the writes of 100 ms of audio per recorder.
+				wakeUp.Wait(webrtc::TimeDelta::Millis(100));
+
+				webrtc::MutexLock lock(&mutex);
+
+				if (!running) {
+					return false;
+				}
+
+				for (AudioTrackRecorder * recorder : recorders) {
+					recorder->drain();
+				}
+
+				return true;
+			}
+
+		private:
+			// Serializes starting and stopping the thread.
+			std::mutex threadMutex;
+
+			// Held while the rings are drained, so that removal waits for a
+			// running drain to finish.
+			webrtc::Mutex mutex;
+			std::vector<AudioTrackRecorder *> recorders RTC_GUARDED_BY(mutex);
+			bool running RTC_GUARDED_BY(mutex);
+
+			webrtc::Event wakeUp;
+			webrtc::PlatformThread thread;
+	};
+
+
+	AudioTrackRecorder::AudioTrackRecorder(const std::string & fileName, FileFormat format, size_t bufferSize) :
+		format(format),
+		// Keep wrapped writes aligned to 16-bit samples.
+		ring(bufferSize & ~static_cast<size_t>(1)),
+		streamSampleRate(0),
+		streamChannels(0),
+		file(webrtc::FileWrapper::OpenWriteOnly(fileName)),
+		writtenFrames(0),
+		droppedCount(0)
+	{
+		if (!file.is_open()) {
+			throw Exception("Failed to open file: %s", fileName.c_str());
+		}
+
+		AudioTrackRecorderWriter::instance().add(this);
+	}
+
+	AudioTrackRecorder::~AudioTrackRecorder()
+	{
+		AudioTrackRecorderWriter::instance().remove(this);
+
+		// The writer thread is done with this recorder, flush the rest here.
+		drain();
+
+		if (format == FileFormat::kWav && !wavWriter) {
+			// Nothing was recorded, still leave a valid WAV file behind.
+			wavWriter = std::make_unique<webrtc::WavWriter>(std::move(file), 48000, 1);
+		}
+
+		// Closing the writer finalizes the WAV header.
+		wavWriter.reset();
+		file.Close();
+	}
+
+	void AudioTrackRecorder::OnData(const void * data, int bitsPerSample, int sampleRate, size_t channels,
+		size_t frames)
+	{
+		if (bitsPerSample != 16 || channels == 0) {
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		if (streamSampleRate == 0) {
+			streamSampleRate = sampleRate;
+			streamChannels = channels;
+		}
+		else if (sampleRate != streamSampleRate || channels != streamChannels) {
+			// The file format is fixed by the first chunk.
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		uint32_t newMicLevel = 0;
+
+		ring.RecordedDataIsAvailable(data, frames, channels * sizeof(int16_t), channels,
+			static_cast<uint32_t>(sampleRate), 0, 0, 0, false, newMicLevel);
+	}
+
+	uint64_t AudioTrackRecorder::getWrittenFrames() const
+	{
+		return writtenFrames.load(std::memory_order_relaxed);
+	}
+
+	uint64_t AudioTrackRecorder::getDroppedCount() const
+	{
+		return droppedCount.load(std::memory_order_relaxed) + ring.getOverrunCount();
+	}
+
+	void AudioTrackRecorder::drain()
+	{
+		const uint64_t writePosition = ring.getWritePosition();
+		const uint64_t readPosition = ring.getReadPosition();
+
+		if (writePosition == readPosition) {
+			return;
+		}
+
+		// The format is published together with the write position.
+		const size_t channels = ring.getChannels();
+		const size_t capacity = ring.getCapacity();
+		const size_t size = static_cast<size_t>(writePosition - readPosition);
+		const size_t offset = static_cast<size_t>(readPosition % capacity);
+		const size_t first = std::min(size, capacity - offset);
+
+		write(ring.data() + offset, first);
+		write(ring.data(), size - first);
+
+		ring.setReadPosition(writePosition);
+
+		writtenFrames.fetch_add(size / (channels * sizeof(int16_t)), std::memory_order_relaxed);
+	}
+
+	void AudioTrackRecorder::write(const uint8_t * data, size_t size)
+	{
+		if (size == 0) {
+			return;
+		}
+
+		if (format == FileFormat::kWav) {
+			if (!wavWriter) {
+				wavWriter = std::make_unique<webrtc::WavWriter>(std::move(file),
+					static_cast<int>(ring.getSampleRate()), ring.getChannels());
+			}
+
+			wavWriter->WriteSamples(reinterpret_cast<const int16_t *>(data), size / sizeof(int16_t));
+		}
+		else {
+			file.Write(data, size);
+		}
+	}
+}
@@ -1,15 +1,82 @@
 #include "media/audio/CustomAudioSource.h"
+#include "Exception.h"
+
+#include "api/audio/audio_frame.h"
+#include "common_audio/include/audio_util.h"
 
 #include <algorithm>
+#include <thread>
 #include <absl/types/optional.h>
 
 namespace jni
 {
+    // Converts 8-bit unsigned, packed 24-bit and 32-bit integer samples to 16-bit.
+    static void ToS16(const void * audio_data, int bits_per_sample, size_t samples, int16_t * dest)
+    {
+        const uint8_t * bytes = static_cast<const uint8_t *>(audio_data);
+
+        switch (bits_per_sample) {
+            case 8:
+                for (size_t i = 0; i < samples; i++) {
+                    dest[i] = static_cast<int16_t>((bytes[i] - 128) * 256);
+                }
+                break;
+
+            case 24:
+                // Little-endian, the upper two bytes form the 16-bit sample.
+                for (size_t i = 0; i < samples; i++) {
+                    dest[i] = static_cast<int16_t>(bytes[i * 3 + 1] | (bytes[i * 3 + 2] << 8));
+                }
+                break;
+
+            case 32:
+                for (size_t i = 0; i < samples; i++) {
+                    dest[i] = static_cast<int16_t>(static_cast<const int32_t *>(audio_data)[i] >> 16);
+                }
+                break;
+
+            default:
+                throw Exception("Cannot convert %d-bit audio", bits_per_sample);
+        }
+    }
+
+    // Returns a buffer of the calling thread for the 16-bit form of a push.
+    static int16_t * GetSampleBuffer(size_t samples)
+    {
+        thread_local std::vector<int16_t> buffer;
+
+        if (buffer.size() < samples) {
+            buffer.resize(samples);
+        }
+
+        return buffer.data();
+    }
+
     CustomAudioSource::CustomAudioSource(std::shared_ptr<SyncClock> clock) :
+        sinks_(new SinkList()),
+        sink_epoch_(0),
+        sink_readers_{},
         clock_(clock),
         total_samples_captured_(0),
-        audio_capture_delay_us_(0)
+        audio_capture_delay_us_(0),
+        processing_(false),
+        target_sample_rate_(0),
+        target_channels_(0),
+        converter_sample_rate_(0),
+        converter_channels_(0),
+        converter_frames_(0),
+        pending_(webrtc::AudioFrame::kMaxDataSizeSamples),
+        pending_samples_(0),
+        pending_sample_rate_(0),
+        pending_channels_(0)
+    {
+    }
+
+    CustomAudioSource::~CustomAudioSource()
     {
+        StopPacing();
+
+        delete sinks_.load();
     }
 
     void CustomAudioSource::RegisterObserver(webrtc::ObserverInterface * observer)
@@ -24,16 +91,41 @@ namespace jni
 
     void CustomAudioSource::AddSink(webrtc::AudioTrackSinkInterface * sink)
     {
-        //webrtc::CritScope lock(&crit_);
+        std::lock_guard<std::mutex> lock(sinks_mutex_);
+
+        SinkList * sinks = new SinkList(*sinks_.load());
+        sinks->push_back(sink);
 
-        sinks_.push_back(sink);
+        PublishSinks(sinks);
     }
 
     void CustomAudioSource::RemoveSink(webrtc::AudioTrackSinkInterface * sink)
     {
-        //webrtc::CritScope lock(&crit_);
+        std::lock_guard<std::mutex> lock(sinks_mutex_);
+
+        SinkList * sinks = new SinkList(*sinks_.load());
+        sinks->erase(std::remove(sinks->begin(), sinks->end(), sink), sinks->end());
+
+        PublishSinks(sinks);
+    }
+
+    void CustomAudioSource::PublishSinks(const SinkList * sinks)
+    {
+        const SinkList * previous = sinks_.exchange(sinks);
+
+        // A push that registered itself before the exchange may still iterate
+        // the previous snapshot, in either reader slot. Advancing the epoch
+        // moves new pushes to the other slot, so each slot drains in turn.
+        // Pushes registering after the exchange see the new snapshot.
+        for (int i = 0; i < 2; i++) {
+            const unsigned epoch = sink_epoch_.fetch_add(1);
+
+            while (sink_readers_[epoch & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
 
-        sinks_.erase(std::remove(sinks_.begin(), sinks_.end(), sink), sinks_.end());
+        delete previous;
     }
 
     webrtc::AudioSourceInterface::SourceState CustomAudioSource::state() const
@@ -50,8 +142,30 @@ namespace jni
                                          int sample_rate, size_t number_of_channels,
                                          size_t number_of_frames)
     {
-        //webrtc::CritScope lock(&crit_);
+        if (bits_per_sample == 16) {
+            PushAudioData(static_cast<const int16_t *>(audio_data), sample_rate, number_of_channels, number_of_frames);
+            return;
+        }
+
+        // Other formats are passed through unless they have to be converted
+        // or paced, which is done in 16-bit.
+        if (!processing_.load(std::memory_order_acquire)) {
+            DeliverAudioData(audio_data, bits_per_sample, sample_rate, number_of_channels, number_of_frames);
+            return;
+        }
+
+        const size_t samples = number_of_frames * number_of_channels;
+        int16_t * buffer = GetSampleBuffer(samples);
 
+        ToS16(audio_data, bits_per_sample, samples, buffer);
+
+        PushAudioData(buffer, sample_rate, number_of_channels, number_of_frames);
+    }
+
+    void CustomAudioSource::DeliverAudioData(const void * audio_data, int bits_per_sample,
+                                            int sample_rate, size_t number_of_channels,
+                                            size_t number_of_frames)
+    {
         // Calculate absolute capture time
         int64_t timestamp_us = clock_->GetTimestampUs();
 
@@ -65,16 +179,239 @@ namespace jni
         absl::optional<int64_t> absolute_capture_time_ms = timestamp_us / 1000;
 
         // Send to all sinks with timing information
-        for (auto * sink : sinks_) {
+        std::atomic<int> & readers = sink_readers_[sink_epoch_.load() & 1];
+
+        readers.fetch_add(1);
+
+        for (auto * sink : *sinks_.load()) {
             sink->OnData(audio_data, bits_per_sample, sample_rate,
                         number_of_channels, number_of_frames,
                         absolute_capture_time_ms);
         }
 
+        readers.fetch_sub(1);
+
         // Update total samples for tracking
         total_samples_captured_ += number_of_frames;
     }
 
+    void CustomAudioSource::PushAudioData(const int16_t * audio_data, int sample_rate,
+                                         size_t number_of_channels, size_t number_of_frames)
+    {
+        if (!processing_.load(std::memory_order_acquire)) {
+            DeliverAudioData(audio_data, 16, sample_rate, number_of_channels, number_of_frames);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(convert_mutex_);
+
+        PushConvertedData(audio_data, sample_rate, number_of_channels, number_of_frames);
+    }
+
+    void CustomAudioSource::PushAudioData(const float * audio_data, int sample_rate,
+                                         size_t number_of_channels, size_t number_of_frames)
+    {
+        const size_t samples = number_of_frames * number_of_channels;
+        int16_t * buffer = GetSampleBuffer(samples);
+
+        webrtc::FloatToS16(audio_data, samples, buffer);
+
+        PushAudioData(buffer, sample_rate, number_of_channels, number_of_frames);
+    }
+
+    void CustomAudioSource::SetTargetFormat(int sample_rate, size_t number_of_channels)
+    {
+        std::lock_guard<std::mutex> lock(convert_mutex_);
+
+        if (pacer_) {
+            throw Exception("The target format cannot be changed while pacing");
+        }
+
+        target_sample_rate_ = sample_rate;
+        target_channels_ = number_of_channels;
+        converter_.reset();
+        pending_samples_ = 0;
+
+        processing_.store(sample_rate > 0, std::memory_order_release);
+    }
+
+    void CustomAudioSource::PushConvertedData(const int16_t * audio_data, int sample_rate,
+                                             size_t number_of_channels, size_t number_of_frames)
+    {
+        const bool convert = target_sample_rate_ > 0 &&
+            (sample_rate != target_sample_rate_ || number_of_channels != target_channels_);
+
+        if (convert) {
+            PushChunks(audio_data, sample_rate, number_of_channels, number_of_frames);
+        }
+        else if (pacer_) {
+            pacer_->write(audio_data, number_of_frames);
+        }
+        else {
+            DeliverAudioData(audio_data, 16, sample_rate, number_of_channels, number_of_frames);
+        }
+    }
+
+    void CustomAudioSource::PushChunks(const int16_t * audio_data, int sample_rate,
+                                      size_t number_of_channels, size_t number_of_frames)
+    {
+        if (sample_rate <= 0 || sample_rate % 100 != 0) {
+            throw Exception("Cannot convert audio with a sample rate of %d Hz", sample_rate);
+        }
+
+        const size_t chunk_frames = static_cast<size_t>(sample_rate / 100);
+        const size_t chunk_samples = chunk_frames * number_of_channels;
+
+        if (chunk_samples > pending_.size()) {
+            throw Exception("Cannot convert audio with %d channels at %d Hz",
+                static_cast<int>(number_of_channels), sample_rate);
+        }
+
+        if (pending_sample_rate_ != sample_rate || pending_channels_ != number_of_channels) {
+            pending_samples_ = 0;
+            pending_sample_rate_ = sample_rate;
+            pending_channels_ = number_of_channels;
+        }
+
+        size_t remaining = number_of_frames * number_of_channels;
+
+        // Complete the chunk left over from the previous push.
+        if (pending_samples_ > 0) {
+            const size_t count = std::min(remaining, chunk_samples - pending_samples_);
+
+            std::copy(audio_data, audio_data + count, pending_.data() + pending_samples_);
+
+            audio_data += count;
+            remaining -= count;
+            pending_samples_ += count;
+
+            if (pending_samples_ < chunk_samples) {
+                return;
+            }
+
+            PushChunk(pending_.data(), sample_rate, number_of_channels, chunk_frames);
+            pending_samples_ = 0;
+        }
+
+        // Whole chunks are converted in place.
+        while (remaining >= chunk_samples) {
+            PushChunk(audio_data, sample_rate, number_of_channels, chunk_frames);
+
+            audio_data += chunk_samples;
+            remaining -= chunk_samples;
+        }
+
+        std::copy(audio_data, audio_data + remaining, pending_.data());
+        pending_samples_ = remaining;
+    }
+
+    void CustomAudioSource::PushChunk(const int16_t * audio_data, int sample_rate,
+                                     size_t number_of_channels, size_t number_of_frames)
+    {
+        const size_t target_frames = ConvertData(audio_data, sample_rate, number_of_channels, number_of_frames);
+
+        if (pacer_) {
+            pacer_->write(convert_buffer_.data(), target_frames);
+        }
+        else {
+            DeliverAudioData(convert_buffer_.data(), 16, target_sample_rate_, target_channels_, target_frames);
+        }
+    }
+
+    size_t CustomAudioSource::ConvertData(const int16_t * audio_data, int sample_rate,
+                                         size_t number_of_channels, size_t number_of_frames)
+    {
+        // Chunks are 10 ms long, which is always a whole number of target frames.
+        const size_t target_frames = static_cast<size_t>(static_cast<uint64_t>(number_of_frames) * target_sample_rate_ / sample_rate);
+        const size_t max_channels = std::max(number_of_channels, target_channels_);
+
+        if (std::max(number_of_frames, target_frames) * max_channels > webrtc::AudioFrame::kMaxDataSizeSamples) {
+            throw Exception("Audio chunk of %d frames is too large to be converted",
+                static_cast<int>(number_of_frames));
+        }
+
+        // The converter is only rebuilt when the input format changes, so that
+        // the resampler state carries over between chunks. The target format
+        // resets the converter when it changes.
+        if (!converter_ ||
+            converter_sample_rate_ != sample_rate ||
+            converter_channels_ != number_of_channels ||
+            converter_frames_ != number_of_frames) {
+            converter_ = AudioConverter::create(number_of_frames, number_of_channels, target_frames, target_channels_);
+            converter_sample_rate_ = sample_rate;
+            converter_channels_ = number_of_channels;
+            converter_frames_ = number_of_frames;
+        }
+
+        const size_t target_samples = target_frames * target_channels_;
+
+        if (convert_buffer_.size() < target_samples) {
+            convert_buffer_.resize(target_samples);
+        }
+
+        converter_->convert(audio_data, number_of_frames * number_of_channels, convert_buffer_.data(), target_samples);
+
+        return target_frames;
+    }
+
+    void CustomAudioSource::StartPacing(int sample_rate, size_t number_of_channels, size_t buffer_frames)
+    {
+        std::unique_ptr<AudioPacer> previous;
+
+        {
+            std::lock_guard<std::mutex> lock(convert_mutex_);
+
+            previous = std::move(pacer_);
+
+            target_sample_rate_ = sample_rate;
+            target_channels_ = number_of_channels;
+            converter_.reset();
+            pending_samples_ = 0;
+
+            pacer_ = std::make_unique<AudioPacer>(sample_rate, number_of_channels, buffer_frames, clock_,
+                [this, sample_rate, number_of_channels](const int16_t * data, size_t frames) {
+                    DeliverAudioData(data, 16, sample_rate, number_of_channels, frames);
+                });
+            pacer_->start();
+
+            processing_.store(true, std::memory_order_release);
+        }
+
+        // Join the previous pacer thread outside of the lock.
+        previous.reset();
+    }
+
+    void CustomAudioSource::StopPacing()
+    {
+        std::unique_ptr<AudioPacer> pacer;
+
+        {
+            std::lock_guard<std::mutex> lock(convert_mutex_);
+
+            pacer = std::move(pacer_);
+            pending_samples_ = 0;
+
+            processing_.store(target_sample_rate_ > 0, std::memory_order_release);
+        }
+
+        pacer.reset();
+    }
+
+    bool CustomAudioSource::GetPacingStats(size_t & buffered_frames, uint64_t & underruns, uint64_t & overruns)
+    {
+        std::lock_guard<std::mutex> lock(convert_mutex_);
+
+        if (!pacer_) {
+            return false;
+        }
+
+        buffered_frames = pacer_->getBufferedFrames();
+        underruns = pacer_->getUnderrunCount();
+        overruns = pacer_->getOverrunCount();
+
+        return true;
+    }
+
     void CustomAudioSource::SetAudioCaptureDelay(int64_t delay_us)
     {
         audio_capture_delay_us_ = delay_us;
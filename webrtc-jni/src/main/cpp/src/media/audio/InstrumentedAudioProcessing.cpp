@@ -0,0 +1,254 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/InstrumentedAudioProcessing.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	InstrumentedAudioProcessing::InstrumentedAudioProcessing(webrtc::scoped_refptr<webrtc::AudioProcessing> apm) :
+		apm(apm),
+		lastSnapshot(std::chrono::steady_clock::now())
+	{
+	}
+
+	void InstrumentedAudioProcessing::getTimings(Timing & captureTiming, Timing & renderTiming)
+	{
+		webrtc::MutexLock lock(&snapshotMutex);
+
+		const auto now = std::chrono::steady_clock::now();
+		const double elapsedSeconds = std::chrono::duration<double>(now - lastSnapshot).count();
+
+		capture.read(captureTiming, elapsedSeconds);
+		render.read(renderTiming, elapsedSeconds);
+
+		lastSnapshot = now;
+	}
+
+	void InstrumentedAudioProcessing::Recorder::record(std::chrono::steady_clock::time_point start)
+	{
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		const uint64_t micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+		const auto bound = std::lower_bound(kBucketBounds.begin(), kBucketBounds.end(), static_cast<int64_t>(micros));
+
+		histogram[static_cast<size_t>(bound - kBucketBounds.begin())].fetch_add(1, std::memory_order_relaxed);
+
+		calls.fetch_add(1, std::memory_order_relaxed);
+		totalMicros.fetch_add(micros, std::memory_order_relaxed);
+
+		uint64_t max = maxMicros.load(std::memory_order_relaxed);
+
+		while (max < micros && !maxMicros.compare_exchange_weak(max, micros, std::memory_order_relaxed)) {
+		}
+	}
+
+	void InstrumentedAudioProcessing::Recorder::read(Timing & timing, double elapsedSeconds)
+	{
+		timing.calls = calls.load(std::memory_order_relaxed);
+		timing.totalMicros = totalMicros.load(std::memory_order_relaxed);
+		timing.maxMicros = maxMicros.load(std::memory_order_relaxed);
+		timing.callsPerSecond = elapsedSeconds > 0 ? (timing.calls - lastCalls) / elapsedSeconds : 0;
+
+		for (size_t i = 0; i < kBucketCount; ++i) {
+			timing.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+		}
+
+		lastCalls = timing.calls;
+	}
+
+	int InstrumentedAudioProcessing::Initialize()
+	{
+		return apm->Initialize();
+	}
+
+	int InstrumentedAudioProcessing::Initialize(const webrtc::ProcessingConfig & processingConfig)
+	{
+		return apm->Initialize(processingConfig);
+	}
+
+	void InstrumentedAudioProcessing::ApplyConfig(const Config & config)
+	{
+		apm->ApplyConfig(config);
+	}
+
+	int InstrumentedAudioProcessing::proc_sample_rate_hz() const
+	{
+		return apm->proc_sample_rate_hz();
+	}
+
+	int InstrumentedAudioProcessing::proc_split_sample_rate_hz() const
+	{
+		return apm->proc_split_sample_rate_hz();
+	}
+
+	size_t InstrumentedAudioProcessing::num_input_channels() const
+	{
+		return apm->num_input_channels();
+	}
+
+	size_t InstrumentedAudioProcessing::num_proc_channels() const
+	{
+		return apm->num_proc_channels();
+	}
+
+	size_t InstrumentedAudioProcessing::num_output_channels() const
+	{
+		return apm->num_output_channels();
+	}
+
+	size_t InstrumentedAudioProcessing::num_reverse_channels() const
+	{
+		return apm->num_reverse_channels();
+	}
+
+	void InstrumentedAudioProcessing::set_output_will_be_muted(bool muted)
+	{
+		apm->set_output_will_be_muted(muted);
+	}
+
+	void InstrumentedAudioProcessing::SetRuntimeSetting(RuntimeSetting setting)
+	{
+		apm->SetRuntimeSetting(setting);
+	}
+
+	bool InstrumentedAudioProcessing::PostRuntimeSetting(RuntimeSetting setting)
+	{
+		return apm->PostRuntimeSetting(setting);
+	}
+
+	int InstrumentedAudioProcessing::ProcessStream(const int16_t * const src, const webrtc::StreamConfig & inputConfig,
+		const webrtc::StreamConfig & outputConfig, int16_t * const dest)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const int result = apm->ProcessStream(src, inputConfig, outputConfig, dest);
+
+		capture.record(start);
+
+		return result;
+	}
+
+	int InstrumentedAudioProcessing::ProcessStream(const float * const * src, const webrtc::StreamConfig & inputConfig,
+		const webrtc::StreamConfig & outputConfig, float * const * dest)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const int result = apm->ProcessStream(src, inputConfig, outputConfig, dest);
+
+		capture.record(start);
+
+		return result;
+	}
+
+	int InstrumentedAudioProcessing::ProcessReverseStream(const int16_t * const src, const webrtc::StreamConfig & inputConfig,
+		const webrtc::StreamConfig & outputConfig, int16_t * const dest)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const int result = apm->ProcessReverseStream(src, inputConfig, outputConfig, dest);
+
+		render.record(start);
+
+		return result;
+	}
+
+	int InstrumentedAudioProcessing::ProcessReverseStream(const float * const * src, const webrtc::StreamConfig & inputConfig,
+		const webrtc::StreamConfig & outputConfig, float * const * dest)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const int result = apm->ProcessReverseStream(src, inputConfig, outputConfig, dest);
+
+		render.record(start);
+
+		return result;
+	}
+
+	int InstrumentedAudioProcessing::AnalyzeReverseStream(const float * const * data, const webrtc::StreamConfig & reverseConfig)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const int result = apm->AnalyzeReverseStream(data, reverseConfig);
+
+		render.record(start);
+
+		return result;
+	}
+
+	bool InstrumentedAudioProcessing::GetLinearAecOutput(webrtc::ArrayView<std::array<float, 160>> linearOutput) const
+	{
+		return apm->GetLinearAecOutput(linearOutput);
+	}
+
+	void InstrumentedAudioProcessing::set_stream_analog_level(int level)
+	{
+		apm->set_stream_analog_level(level);
+	}
+
+	int InstrumentedAudioProcessing::recommended_stream_analog_level() const
+	{
+		return apm->recommended_stream_analog_level();
+	}
+
+	int InstrumentedAudioProcessing::set_stream_delay_ms(int delay)
+	{
+		return apm->set_stream_delay_ms(delay);
+	}
+
+	int InstrumentedAudioProcessing::stream_delay_ms() const
+	{
+		return apm->stream_delay_ms();
+	}
+
+	void InstrumentedAudioProcessing::set_stream_key_pressed(bool keyPressed)
+	{
+		apm->set_stream_key_pressed(keyPressed);
+	}
+
+	bool InstrumentedAudioProcessing::CreateAndAttachAecDump(absl::string_view fileName, int64_t maxLogSizeBytes,
+		webrtc::TaskQueueBase * workerQueue)
+	{
+		return apm->CreateAndAttachAecDump(fileName, maxLogSizeBytes, workerQueue);
+	}
+
+	bool InstrumentedAudioProcessing::CreateAndAttachAecDump(FILE * handle, int64_t maxLogSizeBytes,
+		webrtc::TaskQueueBase * workerQueue)
+	{
+		return apm->CreateAndAttachAecDump(handle, maxLogSizeBytes, workerQueue);
+	}
+
+	void InstrumentedAudioProcessing::AttachAecDump(std::unique_ptr<webrtc::AecDump> aecDump)
+	{
+		apm->AttachAecDump(std::move(aecDump));
+	}
+
+	void InstrumentedAudioProcessing::DetachAecDump()
+	{
+		apm->DetachAecDump();
+	}
+
+	webrtc::AudioProcessingStats InstrumentedAudioProcessing::GetStatistics()
+	{
+		return apm->GetStatistics();
+	}
+
+	webrtc::AudioProcessingStats InstrumentedAudioProcessing::GetStatistics(bool hasRemoteTracks)
+	{
+		return apm->GetStatistics(hasRemoteTracks);
+	}
+
+	webrtc::AudioProcessing::Config InstrumentedAudioProcessing::GetConfig() const
+	{
+		return apm->GetConfig();
+	}
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/StreamingAudioResampler.h"
+
+#include "common_audio/include/audio_util.h"
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+namespace jni
+{
+	// Returns the block size closest to 10 ms for which the ratio of input and
+	// output frames exactly matches the ratio of the sample rates.
+	static size_t getBlockFrames(int sampleRate, int srcSampleRate, int dstSampleRate)
+	{
+		const int divisor = std::gcd(srcSampleRate, dstSampleRate);
+		const size_t minSrcFrames = static_cast<size_t>(srcSampleRate / divisor);
+		const size_t blocks = std::max<size_t>(1, static_cast<size_t>(srcSampleRate / 100) / minSrcFrames);
+
+		return blocks * static_cast<size_t>(sampleRate / divisor);
+	}
+
+	StreamingAudioResampler::StreamingAudioResampler(int srcSampleRate, int dstSampleRate, size_t channels) :
+		channels(channels),
+		srcBlockFrames(getBlockFrames(srcSampleRate, srcSampleRate, dstSampleRate)),
+		dstBlockFrames(getBlockFrames(dstSampleRate, srcSampleRate, dstSampleRate)),
+		srcBlock(srcBlockFrames * channels),
+		srcBlockFill(0),
+		outputStart(0)
+	{
+		if (srcSampleRate != dstSampleRate) {
+			for (size_t i = 0; i < channels; ++i) {
+				resamplers.push_back(std::make_unique<webrtc::PushSincResampler>(srcBlockFrames, dstBlockFrames));
+			}
+
+			dstBlock.resize(dstBlockFrames * channels);
+		}
+	}
+
+	size_t StreamingAudioResampler::resample(const int16_t * src, size_t srcFrames, int16_t * dst, size_t dstCapacity)
+	{
+		write(src, srcFrames);
+
+		return read(dst, dstCapacity);
+	}
+
+	size_t StreamingAudioResampler::resample(const float * src, size_t srcFrames, float * dst, size_t dstCapacity)
+	{
+		write(src, srcFrames);
+
+		return read(dst, dstCapacity);
+	}
+
+	size_t StreamingAudioResampler::getChannels() const
+	{
+		return channels;
+	}
+
+	size_t StreamingAudioResampler::getAvailableFrames() const
+	{
+		return (output.size() - outputStart) / channels;
+	}
+
+	void StreamingAudioResampler::reset()
+	{
+		srcBlockFill = 0;
+		output.clear();
+		outputStart = 0;
+
+		for (auto & resampler : resamplers) {
+			resampler = std::make_unique<webrtc::PushSincResampler>(srcBlockFrames, dstBlockFrames);
+		}
+	}
+
+	template <typename T>
+	void StreamingAudioResampler::write(const T * src, size_t frames)
+	{
+		// Release the consumed output before appending to it.
+		if (outputStart > 0) {
+			output.erase(output.begin(), output.begin() + outputStart);
+			outputStart = 0;
+		}
+
+		while (frames > 0) {
+			const size_t count = std::min(frames, srcBlockFrames - srcBlockFill);
+
+			for (size_t c = 0; c < channels; ++c) {
+				float * channel = srcBlock.data() + c * srcBlockFrames + srcBlockFill;
+
+				for (size_t i = 0; i < count; ++i) {
+					channel[i] = static_cast<float>(src[i * channels + c]);
+				}
+			}
+
+			src += count * channels;
+			frames -= count;
+			srcBlockFill += count;
+
+			if (srcBlockFill == srcBlockFrames) {
+				processBlock();
+				srcBlockFill = 0;
+			}
+		}
+	}
+
+	void StreamingAudioResampler::processBlock()
+	{
+		const float * planar = srcBlock.data();
+		size_t frames = srcBlockFrames;
+
+		if (!resamplers.empty()) {
+			for (size_t c = 0; c < channels; ++c) {
+				resamplers[c]->Resample(srcBlock.data() + c * srcBlockFrames, srcBlockFrames,
+					dstBlock.data() + c * dstBlockFrames, dstBlockFrames);
+			}
+
+			planar = dstBlock.data();
+			frames = dstBlockFrames;
+		}
+
+		const size_t offset = output.size();
+
+		output.resize(offset + frames * channels);
+
+		float * dst = output.data() + offset;
+
+		for (size_t c = 0; c < channels; ++c) {
+			const float * channel = planar + c * frames;
+
+			for (size_t i = 0; i < frames; ++i) {
+				dst[i * channels + c] = channel[i];
+			}
+		}
+	}
+
+	template <typename T>
+	size_t StreamingAudioResampler::read(T * dst, size_t capacity)
+	{
+		const size_t frames = std::min(capacity, getAvailableFrames());
+		const float * src = output.data() + outputStart;
+		const size_t samples = frames * channels;
+
+		for (size_t i = 0; i < samples; ++i) {
+			if constexpr (std::is_same_v<T, int16_t>) {
+				// Rounds and saturates.
+				dst[i] = webrtc::FloatS16ToS16(src[i]);
+			}
+			else {
+				dst[i] = src[i];
+			}
+		}
+
+		outputStart += samples;
+
+		return frames;
+	}
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "media/audio/VoiceActivitySegmenter.h"
+
+#include <algorithm>
+
+namespace jni
+{
+	VoiceActivitySegmenter::VoiceActivitySegmenter(int sampleRate, const Params & params) :
+		sampleRate(sampleRate),
+		frameSize(static_cast<size_t>(sampleRate / 100)),
+		threshold(params.threshold),
+		minSpeechSamples(static_cast<int64_t>(params.minSpeechMillis) * sampleRate / 1000),
+		hangoverSamples(static_cast<int64_t>(params.hangoverMillis) * sampleRate / 1000),
+		frame(frameSize),
+		frameFill(0),
+		position(0),
+		speechStart(0),
+		speechEnd(0),
+		inSpeech(false),
+		confirmed(false)
+	{
+	}
+
+	void VoiceActivitySegmenter::process(const int16_t * samples, size_t count, std::vector<Event> & events)
+	{
+		if (frameFill > 0) {
+			const size_t size = std::min(count, frameSize - frameFill);
+
+			std::copy(samples, samples + size, frame.data() + frameFill);
+
+			samples += size;
+			count -= size;
+			frameFill += size;
+
+			if (frameFill < frameSize) {
+				return;
+			}
+
+			processFrame(frame.data(), events);
+			frameFill = 0;
+		}
+
+		// Full frames are analyzed in place.
+		while (count >= frameSize) {
+			processFrame(samples, events);
+
+			samples += frameSize;
+			count -= frameSize;
+		}
+
+		std::copy(samples, samples + count, frame.data());
+		frameFill = count;
+	}
+
+	void VoiceActivitySegmenter::flush(std::vector<Event> & events)
+	{
+		if (inSpeech && confirmed) {
+			events.push_back({ speechStart, speechEnd });
+		}
+
+		inSpeech = false;
+	}
+
+	void VoiceActivitySegmenter::processFrame(const int16_t * samples, std::vector<Event> & events)
+	{
+		detector.ProcessChunk(samples, frameSize, sampleRate);
+
+		processProbability(detector.last_voice_probability(), events);
+	}
+
+	void VoiceActivitySegmenter::processProbability(float probability, std::vector<Event> & events)
+	{
+		const int64_t frameEnd = position + static_cast<int64_t>(frameSize);
+
+		if (probability >= threshold) {
+			if (!inSpeech) {
+				inSpeech = true;
+				confirmed = false;
+				speechStart = position;
+			}
+
+			speechEnd = frameEnd;
+
+			if (!confirmed && speechEnd - speechStart >= minSpeechSamples) {
+				confirmed = true;
+
+				events.push_back({ speechStart, -1 });
+			}
+		}
+		else if (inSpeech && frameEnd - speechEnd >= hangoverSamples) {
+			flush(events);
+		}
+
+		position = frameEnd;
+	}
+}
@@ -18,9 +18,9 @@
 
 namespace jni
 {
-	WavAudioFileSink::WavAudioFileSink(std::string fileName)
+	WavAudioFileSink::WavAudioFileSink(std::string fileName, int sampleRate, size_t channels)
 	{
-		wavWriter = std::make_unique<webrtc::WavWriter>(fileName, 48000, 2);
+		wavWriter = std::make_unique<webrtc::WavWriter>(fileName, sampleRate, channels);
 	}
 
 	WavAudioFileSink::~WavAudioFileSink()
@@ -28,6 +28,56 @@ import java.nio.ByteBuffer;
  */
 public class RTCDataChannel extends DisposableNativeObject {
 
+	/**
+	 * Protocol token that enables transparent payload compression. When the
+	 * channel protocol, a comma separated list, contains this token, messages
+	 * at or above the compression threshold are deflated natively before
+	 * sending and inflated before they reach the observer. Both peers must use
+	 * this library, since the compressed format is not standardized.
+	 */
+	public static final String COMPRESSION_PROTOCOL = "webrtc-java-deflate";
+
+	/**
+	 * Snapshot slot of the {@link RTCDataChannelState} ordinal, or -1 if the
+	 * channel has been disposed.
+	 */
+	public static final int SNAPSHOT_STATE = 0;
+
+	/**
+	 * Snapshot slot of the buffered amount in bytes.
+	 */
+	public static final int SNAPSHOT_BUFFERED_AMOUNT = 1;
+
+	/**
+	 * Snapshot slot of the number of messages sent.
+	 */
+	public static final int SNAPSHOT_MESSAGES_SENT = 2;
+
+	/**
+	 * Snapshot slot of the number of bytes sent.
+	 */
+	public static final int SNAPSHOT_BYTES_SENT = 3;
+
+	/**
+	 * Snapshot slot of the number of messages received.
+	 */
+	public static final int SNAPSHOT_MESSAGES_RECEIVED = 4;
+
+	/**
+	 * Snapshot slot of the number of bytes received.
+	 */
+	public static final int SNAPSHOT_BYTES_RECEIVED = 5;
+
+	/**
+	 * Snapshot slot of the channel ID, or -1 if not yet assigned.
+	 */
+	public static final int SNAPSHOT_ID = 6;
+
+	/**
+	 * Number of values in the snapshot of one channel.
+	 */
+	public static final int SNAPSHOT_SIZE = 7;
+
 	/**
 	 * Used by the native api.
 	 */
@@ -35,6 +85,25 @@ public class RTCDataChannel extends DisposableNativeObject {
 
 	}
 
+	/**
+	 * Reference to the callback queue of an observer registered with an
+	 * {@link RTCDataChannelExecutor}.
+	 */
+	@SuppressWarnings("unused")
+	private long callbackQueueHandle;
+
+	/**
+	 * Reference to the native payload compressor of this channel.
+	 */
+	@SuppressWarnings("unused")
+	private long compressionHandle;
+
+	/**
+	 * Reference to the native message counters of this channel.
+	 */
+	@SuppressWarnings("unused")
+	private long countersHandle;
+
 	/**
 	 * Register an observer to receive events from this RTCDataChannel. The
 	 * observer will replace the previously registered observer.
@@ -44,7 +113,119 @@ public class RTCDataChannel extends DisposableNativeObject {
 	public native void registerObserver(RTCDataChannelObserver observer);
 
 	/**
-	 * Unregister the last set RTCDataChannelObserver.
+	 * Register an observer that receives messages through the provided buffer
+	 * pool. Each incoming message is copied into a free buffer of the pool and
+	 * announced by its index; the application releases the buffer to the pool
+	 * when done. The observer will replace the previously registered observer.
+	 *
+	 * @param observer The new data channel observer.
+	 * @param pool     The pool to receive messages into.
+	 */
+	public void registerObserver(RTCDataChannelPoolObserver observer, RTCDataChannelBufferPool pool) {
+		if (observer == null || pool == null) {
+			throw new NullPointerException();
+		}
+
+		registerPoolObserver(observer, pool);
+	}
+
+	/**
+	 * Register an observer whose callbacks are run by the provided executor
+	 * instead of the native network thread. Messages and state changes are
+	 * delivered in the order they occurred. Incoming data is queued until the
+	 * observer has processed it; see {@link #getCallbackQueueDepth()}. The
+	 * observer will replace the previously registered observer.
+	 *
+	 * @param observer The new data channel observer.
+	 * @param executor The executor to run the callbacks on.
+	 */
+	public void registerObserver(RTCDataChannelObserver observer, RTCDataChannelExecutor executor) {
+		if (observer == null || executor == null) {
+			throw new NullPointerException();
+		}
+
+		registerQueuedObserver(observer, executor);
+	}
+
+	/**
+	 * Returns the number of callbacks waiting to be run for the observer
+	 * registered with an {@link RTCDataChannelExecutor}. A steadily growing
+	 * value indicates that the observer cannot keep up with the incoming
+	 * messages.
+	 *
+	 * @return The number of pending callbacks, or 0 if the observer is not
+	 *         run by an executor.
+	 */
+	public native int getCallbackQueueDepth();
+
+	/**
+	 * Sets the minimum message size in bytes for compression. Smaller messages
+	 * are sent uncompressed, since deflating them rarely pays off. Has no
+	 * effect unless the channel protocol contains
+	 * {@link #COMPRESSION_PROTOCOL}. The default is 256 bytes.
+	 *
+	 * @param threshold The minimum size of a message to be compressed.
+	 */
+	public native void setCompressionThreshold(int threshold);
+
+	/**
+	 * Returns the payload compression statistics of this channel. All values
+	 * are zero if compression is not enabled.
+	 *
+	 * @return The compression statistics.
+	 */
+	public native RTCDataChannelCompressionStats getCompressionStats();
+
+	/**
+	 * Writes the current state of this channel into the provided array, laid
+	 * out according to the {@code SNAPSHOT_*} slot constants. Unlike the
+	 * individual getters, all values are read in a single native call, which
+	 * makes this method suitable for frequent polling.
+	 * <p>
+	 * Message and byte counters are maintained natively by the send methods
+	 * and the registered observer. Bytes are counted as transmitted, i.e.
+	 * after compression.
+	 *
+	 * @param out The array to fill, at least {@link #SNAPSHOT_SIZE} long.
+	 *
+	 * @throws IllegalArgumentException If the array is too small.
+	 */
+	public void snapshot(long[] out) {
+		if (out.length < SNAPSHOT_SIZE) {
+			throw new IllegalArgumentException("Snapshot array must hold at least " + SNAPSHOT_SIZE + " values");
+		}
+
+		fillSnapshot(out);
+	}
+
+	/**
+	 * Writes the state of all provided channels into a single array with one
+	 * native call. The values of the channel at index {@code i} start at
+	 * {@code i * SNAPSHOT_SIZE}. A {@code null} or disposed channel is
+	 * reported with state -1. The channels must not be disposed concurrently.
+	 *
+	 * @param channels The channels to take a snapshot of.
+	 * @param out      The array to fill, at least
+	 *                 {@code channels.length * SNAPSHOT_SIZE} long.
+	 *
+	 * @throws IllegalArgumentException If the array is too small.
+	 *
+	 * @see #snapshot(long[])
+	 */
+	public static void snapshotAll(RTCDataChannel[] channels, long[] out) {
+		if (out.length < (long) channels.length * SNAPSHOT_SIZE) {
+			throw new IllegalArgumentException("Snapshot array must hold at least "
+					+ ((long) channels.length * SNAPSHOT_SIZE) + " values");
+		}
+
+		fillSnapshots(channels, out);
+	}
+
+	/**
+	 * Unregister the last set RTCDataChannelObserver. Callbacks of an observer
+	 * registered with an {@link RTCDataChannelExecutor} that have not run yet
+	 * are dropped. A callback that is running is waited for, unless this
+	 * method is called from within that callback.
 	 */
 	public native void unregisterObserver();
 
@@ -190,6 +371,14 @@ public class RTCDataChannel extends DisposableNativeObject {
 		return window;
 	}
 
+	private native void registerPoolObserver(RTCDataChannelPoolObserver observer, RTCDataChannelBufferPool pool);
+
+	private native void registerQueuedObserver(RTCDataChannelObserver observer, RTCDataChannelExecutor executor);
+
+	private native void fillSnapshot(long[] out);
+
+	private static native void fillSnapshots(RTCDataChannel[] channels, long[] out);
+
 	private native void sendDirectBuffer(ByteBuffer buffer, boolean binary);
 
 	private native void sendByteArrayBuffer(byte[] buffer, boolean binary);
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A fixed pool of pre-allocated direct buffers that incoming data channel
+ * messages are copied into. Each message is written into the next free
+ * buffer, and the buffer index is handed to
+ * {@link RTCDataChannelPoolObserver#onPooledMessage(int, int, boolean)}. The
+ * application returns the buffer with {@link #release(int)} once it is done
+ * with the message. No memory is allocated per received message.
+ * <p>
+ * A pool may be shared by several data channels.
+ */
+public class RTCDataChannelBufferPool extends DisposableNativeObject {
+
+	private final ByteBuffer[] buffers;
+
+	private volatile boolean disposed;
+
+
+	/**
+	 * Creates a pool over the provided direct buffers. The buffers are owned
+	 * by the pool until it is disposed and must not be written to by the
+	 * application.
+	 *
+	 * @param buffers The direct buffers to receive messages into.
+	 *
+	 * @throws IllegalArgumentException if any of the buffers is not direct.
+	 */
+	public RTCDataChannelBufferPool(ByteBuffer[] buffers) {
+		requireNonNull(buffers);
+
+		for (ByteBuffer buffer : buffers) {
+			requireNonNull(buffer);
+
+			if (!buffer.isDirect()) {
+				throw new IllegalArgumentException("Only direct buffers can be pooled");
+			}
+		}
+
+		this.buffers = buffers.clone();
+
+		initialize(this.buffers);
+	}
+
+	/**
+	 * Returns the number of buffers in this pool.
+	 *
+	 * @return The pool size.
+	 */
+	public int getSize() {
+		return buffers.length;
+	}
+
+	/**
+	 * Returns the buffer at the specified index. The message passed to
+	 * {@link RTCDataChannelPoolObserver#onPooledMessage(int, int, boolean)}
+	 * starts at offset 0 of the buffer.
+	 *
+	 * @param index The buffer index.
+	 *
+	 * @return The buffer at the index.
+	 *
+	 * @throws IndexOutOfBoundsException if the index is out of range.
+	 * @throws IllegalStateException if this pool has been disposed.
+	 */
+	public ByteBuffer getBuffer(int index) {
+		checkIndex(index);
+
+		return buffers[index];
+	}
+
+	/**
+	 * Hands the buffer at the specified index back to the pool, so that it
+	 * can receive the next message. Each buffer passed to
+	 * {@link RTCDataChannelPoolObserver#onPooledMessage(int, int, boolean)}
+	 * must be released exactly once.
+	 *
+	 * @param index The index of the buffer to release.
+	 *
+	 * @throws IndexOutOfBoundsException if the index is out of range.
+	 * @throws IllegalStateException if the buffer is not in use, e.g. because
+	 *                               it has already been released, or if this
+	 *                               pool has been disposed.
+	 */
+	public void release(int index) {
+		checkIndex(index);
+
+		if (!releaseInternal(index)) {
+			throw new IllegalStateException("Buffer " + index + " is not in use");
+		}
+	}
+
+	/**
+	 * Returns the number of buffers that are currently free.
+	 *
+	 * @return The number of free buffers.
+	 */
+	public native int getAvailable();
+
+	/**
+	 * Returns the number of messages that could not be placed into the pool,
+	 * because no free buffer was large enough, and were delivered through
+	 * {@link RTCDataChannelObserver#onMessage(RTCDataChannelBuffer)} instead.
+	 *
+	 * @return The number of messages that bypassed the pool.
+	 */
+	public native long getFallbackCount();
+
+	/**
+	 * Releases this handle to the native pool. The native pool is kept alive
+	 * as long as a data channel observer still uses it. Buffers must not be
+	 * accessed or released after the pool has been disposed.
+	 */
+	@Override
+	public void dispose() {
+		if (disposed) {
+			return;
+		}
+
+		disposed = true;
+
+		disposeInternal();
+	}
+
+	private void checkIndex(int index) {
+		if (disposed) {
+			throw new IllegalStateException("Buffer pool has been disposed");
+		}
+		if (index < 0 || index >= buffers.length) {
+			throw new IndexOutOfBoundsException("Buffer index " + index + " out of range");
+		}
+	}
+
+	private native void initialize(ByteBuffer[] buffers);
+
+	private native boolean releaseInternal(int index);
+
+	private native void disposeInternal();
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+/**
+ * Statistics of the payload compression of a data channel. Compression is
+ * enabled when the channel protocol contains
+ * {@link RTCDataChannel#COMPRESSION_PROTOCOL}. Byte counts refer to message
+ * payloads; wire byte counts include the one byte compression header of each
+ * message.
+ */
+public class RTCDataChannelCompressionStats {
+
+	/** The number of messages sent. */
+	public final long messagesSent;
+
+	/** The number of sent messages that were compressed. */
+	public final long messagesCompressed;
+
+	/** The number of message bytes passed to send. */
+	public final long bytesSent;
+
+	/** The number of bytes handed to the transport for the sent messages. */
+	public final long wireBytesSent;
+
+	/** The number of messages received. */
+	public final long messagesReceived;
+
+	/** The number of message bytes delivered to the observer. */
+	public final long bytesReceived;
+
+	/** The number of bytes received from the transport. */
+	public final long wireBytesReceived;
+
+
+	RTCDataChannelCompressionStats(long messagesSent, long messagesCompressed,
+			long bytesSent, long wireBytesSent, long messagesReceived,
+			long bytesReceived, long wireBytesReceived) {
+		this.messagesSent = messagesSent;
+		this.messagesCompressed = messagesCompressed;
+		this.bytesSent = bytesSent;
+		this.wireBytesSent = wireBytesSent;
+		this.messagesReceived = messagesReceived;
+		this.bytesReceived = bytesReceived;
+		this.wireBytesReceived = wireBytesReceived;
+	}
+
+	/**
+	 * Returns the compression ratio of the sent data, i.e. the message bytes
+	 * divided by the bytes on the wire. Values above 1 mean bandwidth was
+	 * saved.
+	 *
+	 * @return The send compression ratio, or 1 if nothing has been sent.
+	 */
+	public double getSendRatio() {
+		return wireBytesSent > 0 ? (double) bytesSent / wireBytesSent : 1;
+	}
+
+	/**
+	 * Returns the compression ratio of the received data, i.e. the delivered
+	 * message bytes divided by the bytes on the wire.
+	 *
+	 * @return The receive compression ratio, or 1 if nothing has been
+	 *         received.
+	 */
+	public double getReceiveRatio() {
+		return wireBytesReceived > 0 ? (double) bytesReceived / wireBytesReceived : 1;
+	}
+
+	@Override
+	public String toString() {
+		return String.format("%s@%d [messagesSent=%d, messagesCompressed=%d, bytesSent=%d, wireBytesSent=%d, messagesReceived=%d, bytesReceived=%d, wireBytesReceived=%d]",
+				RTCDataChannelCompressionStats.class.getSimpleName(), hashCode(),
+				messagesSent, messagesCompressed, bytesSent, wireBytesSent,
+				messagesReceived, bytesReceived, wireBytesReceived);
+	}
+
+}
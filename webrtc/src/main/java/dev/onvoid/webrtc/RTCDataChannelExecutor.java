@@ -0,0 +1,62 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * A shared pool of native worker threads that run data channel callbacks.
+ * By default, the callbacks of an {@link RTCDataChannelObserver} are invoked
+ * on the native network thread, so a slow observer delays the processing of
+ * all peer connections created by the same factory. An observer registered
+ * with {@link RTCDataChannel#registerObserver(RTCDataChannelObserver,
+ * RTCDataChannelExecutor)} is called on this executor instead.
+ * <p>
+ * Each data channel gets its own serial queue within the executor. The
+ * callbacks of one data channel are delivered in order and never
+ * concurrently, while the callbacks of different data channels may run in
+ * parallel. An executor may be shared by any number of data channels.
+ */
+public class RTCDataChannelExecutor extends DisposableNativeObject {
+
+	/**
+	 * Creates an executor with the specified number of worker threads.
+	 *
+	 * @param threadCount The number of worker threads.
+	 *
+	 * @throws IllegalArgumentException if the thread count is less than 1.
+	 */
+	public RTCDataChannelExecutor(int threadCount) {
+		if (threadCount < 1) {
+			throw new IllegalArgumentException("At least one worker thread is required");
+		}
+
+		initialize(threadCount);
+	}
+
+	/**
+	 * Stops the worker threads and releases this handle to the native
+	 * executor. Callbacks that have not been run yet are dropped. Must not
+	 * be called from within a data channel callback running on this
+	 * executor.
+	 */
+	@Override
+	public native void dispose();
+
+	private native void initialize(int threadCount);
+
+}
@@ -61,7 +61,9 @@ public class RTCDataChannelInit {
 	public int id = -1;
 
 	/**
-	 * Sub-protocol name used for this channel.
+	 * Sub-protocol name used for this channel. A comma separated list that
+	 * contains {@link RTCDataChannel#COMPRESSION_PROTOCOL} enables payload
+	 * compression.
 	 */
 	public String protocol;
 
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc;
+
+/**
+ * An {@link RTCDataChannelObserver} that receives messages through a
+ * {@link RTCDataChannelBufferPool}. Register it with
+ * {@link RTCDataChannel#registerObserver(RTCDataChannelPoolObserver, RTCDataChannelBufferPool)}.
+ * <p>
+ * Messages that do not fit into any free pool buffer are delivered through
+ * {@link #onMessage(RTCDataChannelBuffer)} as usual.
+ */
+public interface RTCDataChannelPoolObserver extends RTCDataChannelObserver {
+
+	/**
+	 * A message was copied into a buffer of the registered pool. The message
+	 * occupies the first {@code length} bytes of the buffer returned by
+	 * {@link RTCDataChannelBufferPool#getBuffer(int)}. The buffer stays
+	 * claimed until it is handed back with
+	 * {@link RTCDataChannelBufferPool#release(int)}, so it may be consumed
+	 * asynchronously.
+	 *
+	 * @param index  The index of the pool buffer containing the message.
+	 * @param length The length of the message in bytes.
+	 * @param binary Whether the message contains UTF-8 text or binary data.
+	 */
+	void onPooledMessage(int index, int length, boolean binary);
+
+}
@@ -37,6 +37,13 @@ public class RTCPeerConnection extends NativeObject {
 	@SuppressWarnings("unused")
 	private long observerHandle;
 
+	/**
+	 * The interned stats object IDs used by {@link RTCStatsSnapshot}. The
+	 * table is released when the PeerConnection is closed.
+	 */
+	@SuppressWarnings("unused")
+	private long statsIdHandle;
+
 
 	/**
 	 * Constructor used by the native api.
@@ -317,6 +324,41 @@ public class RTCPeerConnection extends NativeObject {
 	public native void getStats(RTCRtpSender sender,
 			RTCStatsCollectorCallback callback);
 
+	/**
+	 * Gathers the current statistics of this RTCPeerConnection as a compact
+	 * {@link RTCStatsSnapshot}. Only numeric attributes are included, which
+	 * makes this the preferred method for frequent monitoring of many
+	 * connections.
+	 *
+	 * @param callback The callback to receive the generated snapshot.
+	 */
+	public native void getStatsSnapshot(RTCStatsSnapshotCallback callback);
+
+	/**
+	 * Get the stats object ID for an interned ID of a {@link
+	 * RTCStatsSnapshot}. Interned IDs are never reused, so the table of stats
+	 * object IDs of this connection only grows until it is closed. Long-lived
+	 * connections with many short-lived stats objects, e.g. from frequent
+	 * renegotiation, accumulate their IDs.
+	 *
+	 * @param id The interned ID, see {@link RTCStatsSnapshot#getId(int)}.
+	 *
+	 * @return the stats object ID, or {@code null} if the ID is not assigned
+	 *         or this RTCPeerConnection is closed.
+	 */
+	public native String getStatsId(int id);
+
+	/**
+	 * Get the interned ID of a stats object ID that has been part of a {@link
+	 * RTCStatsSnapshot} of this RTCPeerConnection.
+	 *
+	 * @param statsId The stats object ID.
+	 *
+	 * @return the interned ID, or -1 if the ID has not been seen yet or this
+	 *         RTCPeerConnection is closed.
+	 */
+	public native int getStatsIdIndex(String statsId);
+
 	/**
 	 * Tells the RTCPeerConnection that ICE should be restarted. Subsequent
 	 * calls to {@code createOffer} will create descriptions that will restart
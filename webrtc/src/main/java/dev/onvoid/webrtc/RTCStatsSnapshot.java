@@ -0,0 +1,309 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package dev.onvoid.webrtc;
+
+import dev.onvoid.webrtc.internal.NativeLoader;
+
+/**
+ * A compact, columnar form of an {@link RTCStatsReport} that is meant for
+ * frequent monitoring polls. Each stats object is addressed by its index.
+ * Stats object IDs and numeric attributes are stored in flat arrays, and
+ * strings are replaced by integer IDs, so that a snapshot consists of a few
+ * arrays and reading a value neither boxes nor allocates.
+ * <p>
+ * Boolean, integer and unsigned 64-bit attributes are stored as {@code long},
+ * booleans as 0 or 1. Unsigned 64-bit values keep their bits, use {@link
+ * Long#toUnsignedString(long)} for values beyond {@link Long#MAX_VALUE}.
+ * Floating-point attributes are stored as {@code double}. String, array and
+ * map attributes are not part of a snapshot, use {@link
+ * RTCPeerConnection#getStats(RTCStatsCollectorCallback)} to get them.
+ * <p>
+ * Attribute IDs are assigned once per process and stay valid for its
+ * lifetime. Resolve the IDs of the attributes of interest once with {@link
+ * #getAttributeId(String)} and reuse them for all snapshots. Stats object IDs
+ * are assigned per peer connection and are resolved with {@link
+ * RTCPeerConnection#getStatsId(int)} and {@link
+ * RTCPeerConnection#getStatsIdIndex(String)}.
+ */
+public class RTCStatsSnapshot {
+
+	static {
+		try {
+			NativeLoader.loadLibrary("webrtc-java");
+		}
+		catch (Exception e) {
+			throw new RuntimeException("Load library 'webrtc-java' failed", e);
+		}
+	}
+
+	private static final RTCStatsType[] TYPES = RTCStatsType.values();
+
+	/** The timestamp of the report in microseconds. */
+	private final long timestamp;
+
+	/** The interned IDs of the stats objects. */
+	private final int[] ids;
+
+	/** The RTCStatsType ordinals, -1 for unknown types. */
+	private final byte[] types;
+
+	/** The timestamps of the stats objects in microseconds. */
+	private final long[] timestamps;
+
+	/**
+	 * The attributes of stats object {@code i} are stored from {@code
+	 * offsets[i]} up to, excluding, {@code offsets[i + 1]}.
+	 */
+	private final int[] longOffsets;
+	private final int[] longNames;
+	private final long[] longValues;
+
+	private final int[] doubleOffsets;
+	private final int[] doubleNames;
+	private final double[] doubleValues;
+
+
+	protected RTCStatsSnapshot(long timestamp, int[] ids, byte[] types,
+			long[] timestamps, int[] longOffsets, int[] longNames,
+			long[] longValues, int[] doubleOffsets, int[] doubleNames,
+			double[] doubleValues) {
+		this.timestamp = timestamp;
+		this.ids = ids;
+		this.types = types;
+		this.timestamps = timestamps;
+		this.longOffsets = longOffsets;
+		this.longNames = longNames;
+		this.longValues = longValues;
+		this.doubleOffsets = doubleOffsets;
+		this.doubleNames = doubleNames;
+		this.doubleValues = doubleValues;
+	}
+
+	/**
+	 * Get the timestamp of the snapshot in microseconds.
+	 *
+	 * @return the timestamp in microseconds relative to the UNIX epoch.
+	 */
+	public long getTimestamp() {
+		return timestamp;
+	}
+
+	/**
+	 * Get the number of stats objects in this snapshot.
+	 *
+	 * @return the number of stats objects.
+	 */
+	public int size() {
+		return ids.length;
+	}
+
+	/**
+	 * Get the index of the stats object with the specified interned ID.
+	 *
+	 * @param id The interned ID of the stats object.
+	 *
+	 * @return the index of the stats object, or -1 if there is none.
+	 *
+	 * @see RTCPeerConnection#getStatsIdIndex(String)
+	 */
+	public int indexOf(int id) {
+		for (int i = 0; i < ids.length; i++) {
+			if (ids[i] == id) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	 * Get the interned ID of the stats object at the specified index. The ID
+	 * stays the same for all snapshots of the same peer connection.
+	 *
+	 * @param index The index of the stats object.
+	 *
+	 * @return the interned ID of the stats object.
+	 *
+	 * @see RTCPeerConnection#getStatsId(int)
+	 */
+	public int getId(int index) {
+		return ids[index];
+	}
+
+	/**
+	 * Get the type of the stats object at the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 *
+	 * @return the type of the stats object, or {@code null} if the type is
+	 *         not known.
+	 */
+	public RTCStatsType getType(int index) {
+		int type = types[index];
+
+		return type >= 0 && type < TYPES.length ? TYPES[type] : null;
+	}
+
+	/**
+	 * Get the timestamp of the stats object at the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 *
+	 * @return the timestamp in microseconds relative to the UNIX epoch.
+	 */
+	public long getTimestamp(int index) {
+		return timestamps[index];
+	}
+
+	/**
+	 * Get an integer or boolean attribute of the stats object at the
+	 * specified index.
+	 *
+	 * @param index        The index of the stats object.
+	 * @param attributeId  The ID of the attribute name.
+	 * @param defaultValue The value to return if the attribute is not set.
+	 *
+	 * @return the attribute value, or {@code defaultValue}.
+	 */
+	public long getLong(int index, int attributeId, long defaultValue) {
+		for (int i = longOffsets[index]; i < longOffsets[index + 1]; i++) {
+			if (longNames[i] == attributeId) {
+				return longValues[i];
+			}
+		}
+		return defaultValue;
+	}
+
+	/**
+	 * Get a floating-point attribute of the stats object at the specified
+	 * index.
+	 *
+	 * @param index        The index of the stats object.
+	 * @param attributeId  The ID of the attribute name.
+	 * @param defaultValue The value to return if the attribute is not set.
+	 *
+	 * @return the attribute value, or {@code defaultValue}.
+	 */
+	public double getDouble(int index, int attributeId, double defaultValue) {
+		for (int i = doubleOffsets[index]; i < doubleOffsets[index + 1]; i++) {
+			if (doubleNames[i] == attributeId) {
+				return doubleValues[i];
+			}
+		}
+		return defaultValue;
+	}
+
+	/**
+	 * Get the number of {@code long} attributes of the stats object at the
+	 * specified index. Together with {@link #getLongAttributeId(int, int)}
+	 * and {@link #getLongValue(int, int)} this allows to iterate over all
+	 * attributes.
+	 *
+	 * @param index The index of the stats object.
+	 *
+	 * @return the number of {@code long} attributes.
+	 */
+	public int getLongCount(int index) {
+		return longOffsets[index + 1] - longOffsets[index];
+	}
+
+	/**
+	 * Get the attribute ID of the n-th {@code long} attribute of the stats
+	 * object at the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 * @param n     The attribute number, less than {@link #getLongCount(int)}.
+	 *
+	 * @return the attribute ID.
+	 */
+	public int getLongAttributeId(int index, int n) {
+		return longNames[longOffsets[index] + n];
+	}
+
+	/**
+	 * Get the value of the n-th {@code long} attribute of the stats object at
+	 * the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 * @param n     The attribute number, less than {@link #getLongCount(int)}.
+	 *
+	 * @return the attribute value.
+	 */
+	public long getLongValue(int index, int n) {
+		return longValues[longOffsets[index] + n];
+	}
+
+	/**
+	 * Get the number of {@code double} attributes of the stats object at the
+	 * specified index.
+	 *
+	 * @param index The index of the stats object.
+	 *
+	 * @return the number of {@code double} attributes.
+	 *
+	 * @see #getLongCount(int)
+	 */
+	public int getDoubleCount(int index) {
+		return doubleOffsets[index + 1] - doubleOffsets[index];
+	}
+
+	/**
+	 * Get the attribute ID of the n-th {@code double} attribute of the stats
+	 * object at the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 * @param n     The attribute number, less than {@link #getDoubleCount(int)}.
+	 *
+	 * @return the attribute ID.
+	 */
+	public int getDoubleAttributeId(int index, int n) {
+		return doubleNames[doubleOffsets[index] + n];
+	}
+
+	/**
+	 * Get the value of the n-th {@code double} attribute of the stats object
+	 * at the specified index.
+	 *
+	 * @param index The index of the stats object.
+	 * @param n     The attribute number, less than {@link #getDoubleCount(int)}.
+	 *
+	 * @return the attribute value.
+	 */
+	public double getDoubleValue(int index, int n) {
+		return doubleValues[doubleOffsets[index] + n];
+	}
+
+	/**
+	 * Get the ID of an attribute name, e.g. {@code "bytesReceived"}. The
+	 * names of all attributes known to WebRTC have an ID.
+	 *
+	 * @param name The attribute name.
+	 *
+	 * @return the attribute ID, or -1 if the name is not known.
+	 */
+	public static native int getAttributeId(String name);
+
+	/**
+	 * Get the attribute name of an attribute ID.
+	 *
+	 * @param id The attribute ID.
+	 *
+	 * @return the attribute name, or {@code null} if the ID is not assigned.
+	 */
+	public static native String getAttributeName(int id);
+
+}
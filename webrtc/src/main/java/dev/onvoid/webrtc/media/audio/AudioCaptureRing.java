@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Lock-free single-producer/single-consumer ring buffer that receives
+ * captured audio from an {@link AudioDeviceModuleBase}. The realtime capture
+ * thread copies every 10 ms chunk into native ring memory and never calls into
+ * the JVM, so garbage collection pauses cannot stall audio capture. Java
+ * drains the ring at its own cadence, either with {@link #read(ByteBuffer)} or
+ * directly through {@link #getBuffer()} and the read and write positions.
+ * <p>
+ * If the ring is full, incoming chunks are dropped and counted as overruns
+ * instead of blocking the capture thread. The ring must only be drained by
+ * one thread at a time and must not be disposed while it is set on an audio
+ * device module.
+ *
+ * @see AudioDeviceModuleBase#setAudioCaptureRing(AudioCaptureRing)
+ */
+public class AudioCaptureRing extends DisposableNativeObject {
+
+	/**
+	 * Direct view of the native ring memory.
+	 */
+	private final ByteBuffer buffer;
+
+	/**
+	 * Reused view for copying data out of the ring without allocation.
+	 */
+	private final ByteBuffer readView;
+
+
+	/**
+	 * Creates a new ring buffer with the given capacity. One second of 48 kHz
+	 * stereo 16-bit audio requires 192000 bytes.
+	 *
+	 * @param capacity The capacity of the ring in bytes.
+	 *
+	 * @throws IllegalArgumentException If the capacity is not positive.
+	 */
+	public AudioCaptureRing(int capacity) {
+		if (capacity < 1) {
+			throw new IllegalArgumentException("Capacity must be positive");
+		}
+
+		initialize(capacity);
+
+		buffer = createBuffer().order(ByteOrder.nativeOrder());
+		readView = buffer.duplicate().order(ByteOrder.nativeOrder());
+	}
+
+	/**
+	 * Returns a direct buffer backed by the ring memory. The byte at ring
+	 * position {@code p} is stored at index {@code p % getCapacity()}. Bytes
+	 * between the read and write position are valid and are not overwritten
+	 * until the read position has been advanced past them.
+	 *
+	 * @return The ring memory in native byte order.
+	 */
+	public ByteBuffer getBuffer() {
+		return buffer;
+	}
+
+	/**
+	 * Returns the capacity of the ring in bytes.
+	 *
+	 * @return The ring capacity.
+	 */
+	public int getCapacity() {
+		return buffer.capacity();
+	}
+
+	/**
+	 * Returns the number of bytes that can currently be read.
+	 *
+	 * @return The number of readable bytes.
+	 */
+	public int available() {
+		return (int) (getWritePosition() - getReadPosition());
+	}
+
+	/**
+	 * Copies as many captured bytes as available, up to the remaining space
+	 * of the destination buffer, and releases them to the capture thread.
+	 *
+	 * @param dst The buffer to copy the audio samples into.
+	 *
+	 * @return The number of bytes copied.
+	 */
+	public int read(ByteBuffer dst) {
+		requireNonNull(dst);
+
+		final long readPosition = getReadPosition();
+		final int count = (int) Math.min(getWritePosition() - readPosition, dst.remaining());
+
+		if (count == 0) {
+			return 0;
+		}
+
+		final int capacity = buffer.capacity();
+		final int offset = (int) (readPosition % capacity);
+		final int first = Math.min(count, capacity - offset);
+
+		readView.limit(offset + first);
+		readView.position(offset);
+		dst.put(readView);
+
+		if (count > first) {
+			readView.limit(count - first);
+			readView.position(0);
+			dst.put(readView);
+		}
+
+		setReadPosition(readPosition + count);
+
+		return count;
+	}
+
+	/**
+	 * Returns the total number of bytes written by the capture thread. The
+	 * value only grows; it is not reduced modulo the capacity.
+	 *
+	 * @return The write position in bytes.
+	 */
+	public native long getWritePosition();
+
+	/**
+	 * Returns the total number of bytes consumed by the reader.
+	 *
+	 * @return The read position in bytes.
+	 */
+	public native long getReadPosition();
+
+	/**
+	 * Releases ring memory up to the given position to the capture thread.
+	 * Use this method when reading directly from {@link #getBuffer()}.
+	 *
+	 * @param position The new read position, between the current read and
+	 *                 write position.
+	 */
+	public native void setReadPosition(long position);
+
+	/**
+	 * Returns the number of captured chunks that were dropped because the
+	 * ring was full.
+	 *
+	 * @return The number of overruns.
+	 */
+	public native long getOverrunCount();
+
+	/**
+	 * Returns the sample rate of the most recently captured audio.
+	 *
+	 * @return The sample rate in Hz, or 0 if nothing has been captured yet.
+	 */
+	public native int getSampleRate();
+
+	/**
+	 * Returns the number of channels of the most recently captured audio.
+	 *
+	 * @return The number of channels, or 0 if nothing has been captured yet.
+	 */
+	public native int getChannels();
+
+	/**
+	 * Returns the number of bytes per sample of the most recently captured
+	 * audio.
+	 *
+	 * @return The bytes per sample, or 0 if nothing has been captured yet.
+	 */
+	public native int getBytesPerSample();
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(int capacity);
+
+	private native ByteBuffer createBuffer();
+
+}
@@ -18,10 +18,17 @@ package dev.onvoid.webrtc.media.audio;
 
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 /**
  * Audio format converter to remix and resample audio input data. This converter
- * operates on audio frames of 10 milliseconds. Each sample is assumed to be a
- * 16-bit PCM sample.
+ * operates on audio frames of 10 milliseconds. Samples are either 16-bit PCM
+ * samples or 32-bit float samples. Remixing and resampling run natively in a
+ * single pipeline per frame, using scratch buffers that are allocated once and
+ * reused for every frame.
  *
  * @author Alex Andres
  */
@@ -96,6 +103,54 @@ public class AudioConverter extends DisposableNativeObject {
 		return dstSamplesOut;
 	}
 
+	/**
+	 * Converts a 10 ms frame of 16-bit samples in native byte order from one
+	 * direct buffer into another. The samples are read and written in place,
+	 * starting at the buffer positions, without copying them to the Java heap.
+	 * The buffer positions are not modified.
+	 *
+	 * @param src The direct buffer with the audio samples to convert.
+	 * @param dst The direct buffer for converted audio samples.
+	 *
+	 * @return The number of converted samples.
+	 *
+	 * @throws IllegalArgumentException if a buffer is not direct or holds less
+	 *                                  data than a 10 ms frame.
+	 */
+	public int convert(ByteBuffer src, ByteBuffer dst) {
+		checkBuffers(src, dst, 2);
+
+		convertDirect(src, src.position(), dst, dst.position());
+
+		return dstSamplesOut;
+	}
+
+	/**
+	 * Converts a 10 ms frame of 32-bit float samples from one direct buffer
+	 * into another. The samples are read and written in place, starting at the
+	 * buffer positions. The buffer positions are not modified.
+	 *
+	 * @param src The direct buffer with the audio samples to convert.
+	 * @param dst The direct buffer for converted audio samples.
+	 *
+	 * @return The number of converted samples.
+	 *
+	 * @throws IllegalArgumentException if a buffer is not direct, not in native
+	 *                                  byte order or holds less data than a
+	 *                                  10 ms frame.
+	 */
+	public int convert(FloatBuffer src, FloatBuffer dst) {
+		checkBuffers(src, dst, 1);
+
+		if (src.order() != ByteOrder.nativeOrder() || dst.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Audio buffers must be in native byte order");
+		}
+
+		convertFloatDirect(src, src.position(), dst, dst.position());
+
+		return dstSamplesOut;
+	}
+
 	@Override
 	public native void dispose();
 
@@ -103,4 +158,24 @@ public class AudioConverter extends DisposableNativeObject {
 
 	public native void convertInternal(byte[] src, int nSrcSamples, byte[] dst, int nDstSamples);
 
+	private native void convertDirect(ByteBuffer src, int srcOffset, ByteBuffer dst, int dstOffset);
+
+	private native void convertFloatDirect(FloatBuffer src, int srcOffset, FloatBuffer dst, int dstOffset);
+
+	private void checkBuffers(Buffer src, Buffer dst, int elementsPerSample) {
+		if (!src.isDirect() || !dst.isDirect()) {
+			throw new IllegalArgumentException("Audio buffers must be direct buffers");
+		}
+		if (src.remaining() / elementsPerSample < srcSamples) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient samples input length: %d vs. %d",
+					src.remaining() / elementsPerSample, srcSamples));
+		}
+		if (dst.remaining() / elementsPerSample < dstSamples) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient samples output length: %d vs. %d",
+					dst.remaining() / elementsPerSample, dstSamples));
+		}
+	}
+
 }
@@ -63,6 +63,21 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
      */
     private Map.Entry<AudioSource, Long> sourceEntry;
 
+    /**
+     * The ring buffer receiving captured audio, if set instead of an audio sink.
+     */
+    private AudioCaptureRing captureRing;
+
+    /**
+     * The ring buffer supplying audio for playout, if set instead of an audio source.
+     */
+    private AudioPlaybackRing playbackRing;
+
+    /**
+     * The native audio callback shared by the capture and playback rings.
+     */
+    private long ringTransportHandle;
+
 
     @Override
     public void dispose() {
@@ -72,9 +87,17 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
         if (nonNull(sourceEntry)) {
             removeSourceInternal(sourceEntry.getValue());
         }
+        if (nonNull(captureRing)) {
+            removeCaptureRingInternal();
+        }
+        if (nonNull(playbackRing)) {
+            removePlaybackRingInternal();
+        }
 
         sinkEntry = null;
         sourceEntry = null;
+        captureRing = null;
+        playbackRing = null;
 
         disposeInternal();
     }
@@ -82,7 +105,8 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
     /**
      * Sets the audio sink for this audio device module. If a sink was previously set, it will
      * be removed and replaced with the new sink. If the provided sink is the same as the
-     * current one, this method returns without making any changes.
+     * current one, this method returns without making any changes. Previously set ring
+     * buffers are removed.
      *
      * @param sink the audio sink to set.
      *
@@ -99,15 +123,42 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
             removeSinkInternal(sinkEntry.getValue());
         }
 
+        removeRings();
+
         final long nativeSink = addSinkInternal(sink);
 
         sinkEntry = new SimpleEntry<>(sink, nativeSink);
     }
 
+    /**
+     * Sets a ring buffer that receives captured audio instead of an audio sink. Unlike an
+     * {@link AudioSink}, the ring is filled on the capture thread without calling into the JVM
+     * and is drained by the application at its own cadence. The capture ring can be used
+     * together with a playback ring. A previously set audio sink or source is removed. The
+     * ring must stay alive until it is replaced or this module is disposed.
+     *
+     * @param ring the ring buffer to receive captured audio.
+     *
+     * @throws NullPointerException if the provided ring is null.
+     */
+    public void setAudioCaptureRing(AudioCaptureRing ring) {
+        requireNonNull(ring);
+
+        if (ring == captureRing) {
+            return;
+        }
+
+        removeSinkAndSource();
+        addCaptureRingInternal(ring);
+
+        captureRing = ring;
+    }
+
     /**
      * Sets the audio source for this audio device module. If a source was previously set, it
      * will be removed and replaced with the new source. If the provided source is the same as
-     * the current one, this method returns without making any changes.
+     * the current one, this method returns without making any changes. Previously set ring
+     * buffers are removed.
      *
      * @param source the audio source to set.
      *
@@ -124,11 +175,71 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
             removeSourceInternal(sourceEntry.getValue());
         }
 
+        removeRings();
+
         final long nativeSource = addSourceInternal(source);
 
         sourceEntry = new SimpleEntry<>(source, nativeSource);
     }
 
+    /**
+     * Sets a ring buffer that supplies audio for playout instead of an audio source. Unlike an
+     * {@link AudioSource}, the ring is read on the playout thread without calling into the JVM;
+     * the application writes ahead into it. The playback ring can be used together with a
+     * capture ring. A previously set audio sink or source is removed. The ring must stay alive
+     * until it is replaced or this module is disposed.
+     *
+     * @param ring the ring buffer supplying audio.
+     *
+     * @throws NullPointerException if the provided ring is null.
+     */
+    public void setAudioPlaybackRing(AudioPlaybackRing ring) {
+        requireNonNull(ring);
+
+        if (ring == playbackRing) {
+            return;
+        }
+
+        removeSinkAndSource();
+        addPlaybackRingInternal(ring);
+
+        playbackRing = ring;
+    }
+
+    /**
+     * Removes the audio sink and source, which use the same native audio callback as the
+     * ring buffers.
+     */
+    private void removeSinkAndSource() {
+        if (nonNull(sinkEntry)) {
+            removeSinkInternal(sinkEntry.getValue());
+
+            sinkEntry = null;
+        }
+        if (nonNull(sourceEntry)) {
+            removeSourceInternal(sourceEntry.getValue());
+
+            sourceEntry = null;
+        }
+    }
+
+    /**
+     * Removes the ring buffers, which use the same native audio callback as the audio sink
+     * and source.
+     */
+    private void removeRings() {
+        if (nonNull(captureRing)) {
+            removeCaptureRingInternal();
+
+            captureRing = null;
+        }
+        if (nonNull(playbackRing)) {
+            removePlaybackRingInternal();
+
+            playbackRing = null;
+        }
+    }
+
     /**
      * Initializes the audio playout components and resources. This should be called before
      * starting playback.
@@ -315,4 +426,28 @@ public class AudioDeviceModuleBase extends DisposableNativeObject {
      */
     private native void removeSourceInternal(long sourceHandle);
 
+    /**
+     * Registers a capture ring buffer as the audio callback of the native module.
+     *
+     * @param ring the ring buffer to register.
+     */
+    private native void addCaptureRingInternal(AudioCaptureRing ring);
+
+    /**
+     * Unregisters the capture ring buffer from the native module.
+     */
+    private native void removeCaptureRingInternal();
+
+    /**
+     * Registers a playback ring buffer as the audio callback of the native module.
+     *
+     * @param ring the ring buffer to register.
+     */
+    private native void addPlaybackRingInternal(AudioPlaybackRing ring);
+
+    /**
+     * Unregisters the playback ring buffer from the native module.
+     */
+    private native void removePlaybackRingInternal();
+
 }
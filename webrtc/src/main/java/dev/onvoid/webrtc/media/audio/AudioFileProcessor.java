@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * Runs audio processing, e.g. noise suppression and gain control, over WAV
+ * files on a pool of native worker threads. Each file is processed by its own
+ * audio processing instance with the same configuration, so throughput scales
+ * with the number of workers. The files are read and written natively in
+ * large blocks; no audio passes through Java.
+ * <p>
+ * The output files have the sample rate and channel count of their inputs.
+ */
+public class AudioFileProcessor extends DisposableNativeObject {
+
+	/**
+	 * The processing status of a file.
+	 */
+	public enum Status {
+
+		/** The file waits for a worker. */
+		PENDING,
+
+		/** The file is being processed. */
+		PROCESSING,
+
+		/** The file has been processed completely. */
+		COMPLETED,
+
+		/** The file could not be processed or processing was cancelled. */
+		FAILED
+
+	}
+
+
+	private volatile int fileCount = -1;
+
+
+	/**
+	 * Creates a new {@code AudioFileProcessor} with one worker per available
+	 * processor.
+	 *
+	 * @param config The audio processing configuration applied to each file.
+	 */
+	public AudioFileProcessor(AudioProcessingConfig config) {
+		this(config, Runtime.getRuntime().availableProcessors());
+	}
+
+	/**
+	 * Creates a new {@code AudioFileProcessor}.
+	 *
+	 * @param config      The audio processing configuration applied to each
+	 *                    file.
+	 * @param workerCount The number of files processed in parallel.
+	 *
+	 * @throws IllegalArgumentException if the worker count is not positive.
+	 */
+	public AudioFileProcessor(AudioProcessingConfig config, int workerCount) {
+		requireNonNull(config);
+
+		if (workerCount <= 0) {
+			throw new IllegalArgumentException("Worker count must be positive");
+		}
+
+		initialize(config, workerCount);
+	}
+
+	/**
+	 * Starts processing the input files into the output files in the
+	 * background. The file at each index of the input array is written to
+	 * the file at the same index of the output array. A processor can be
+	 * started only once.
+	 *
+	 * @param inputFiles  The WAV files to process.
+	 * @param outputFiles The WAV files to write.
+	 *
+	 * @throws IllegalArgumentException if the arrays differ in length.
+	 * @throws IllegalStateException    if the processor was already started.
+	 */
+	public synchronized void start(String[] inputFiles, String[] outputFiles) {
+		requireNonNull(inputFiles);
+		requireNonNull(outputFiles);
+
+		if (inputFiles.length != outputFiles.length) {
+			throw new IllegalArgumentException(String.format(
+					"Number of input and output files differ: %d vs. %d",
+					inputFiles.length, outputFiles.length));
+		}
+		if (fileCount >= 0) {
+			throw new IllegalStateException("Audio file processor already started");
+		}
+
+		startInternal(inputFiles, outputFiles);
+
+		fileCount = inputFiles.length;
+	}
+
+	/**
+	 * Blocks until all files have been processed or processing has been
+	 * cancelled.
+	 */
+	public native void await();
+
+	/**
+	 * Stops processing. Files that have not been completed are reported as
+	 * failed. Use {@link #await()} to wait for the workers to stop.
+	 */
+	public native void cancel();
+
+	/**
+	 * Returns the number of files passed to {@link #start}.
+	 *
+	 * @return The number of files, or zero if the processor was not started.
+	 */
+	public int getFileCount() {
+		return Math.max(0, fileCount);
+	}
+
+	/**
+	 * Reads the progress of all files at once.
+	 *
+	 * @param progress The array to receive the progress of each file in the
+	 *                 range [0, 1], in the order the files were passed to
+	 *                 {@link #start}.
+	 *
+	 * @throws IllegalArgumentException if the array is too small.
+	 */
+	public void getProgress(float[] progress) {
+		if (progress.length < getFileCount()) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient progress length: %d vs. %d",
+					progress.length, getFileCount()));
+		}
+
+		getProgressInternal(progress);
+	}
+
+	/**
+	 * Returns the processing status of a file.
+	 *
+	 * @param index The index of the file passed to {@link #start}.
+	 *
+	 * @return The status of the file.
+	 */
+	public Status getStatus(int index) {
+		checkIndex(index);
+
+		return Status.values()[getStatusInternal(index)];
+	}
+
+	/**
+	 * Returns the reason why a file failed.
+	 *
+	 * @param index The index of the file passed to {@link #start}.
+	 *
+	 * @return The error message, or {@code null} if the file did not fail.
+	 */
+	public String getError(int index) {
+		checkIndex(index);
+
+		return getErrorInternal(index);
+	}
+
+	/**
+	 * Cancels processing, waits for the workers to stop and releases native
+	 * resources.
+	 */
+	@Override
+	public native void dispose();
+
+	private void checkIndex(int index) {
+		if (index < 0 || index >= getFileCount()) {
+			throw new IndexOutOfBoundsException("File index: " + index);
+		}
+	}
+
+	private native void initialize(AudioProcessingConfig config, int workerCount);
+
+	private native void startInternal(String[] inputFiles, String[] outputFiles);
+
+	private native void getProgressInternal(float[] progress);
+
+	private native int getStatusInternal(int index);
+
+	private native String getErrorInternal(int index);
+
+}
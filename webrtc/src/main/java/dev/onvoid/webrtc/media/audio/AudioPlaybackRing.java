@@ -0,0 +1,220 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Lock-free single-producer/single-consumer ring buffer that supplies audio
+ * to an {@link AudioDeviceModuleBase} for playout. The application writes
+ * ahead into native ring memory, and the realtime playout thread only reads
+ * from the ring without calling into the JVM, so garbage collection pauses do
+ * not disturb the audio clock.
+ * <p>
+ * Playout starts once the prefill level has been buffered. If the ring runs
+ * empty, the missing audio is replaced with silence, counted as an underrun
+ * and the ring is prefilled again before playout resumes. The ring must only
+ * be written by one thread at a time and must not be disposed while it is set
+ * on an audio device module.
+ *
+ * @see AudioDeviceModuleBase#setAudioPlaybackRing(AudioPlaybackRing)
+ */
+public class AudioPlaybackRing extends DisposableNativeObject {
+
+	/**
+	 * Direct view of the native ring memory.
+	 */
+	private final ByteBuffer buffer;
+
+	/**
+	 * Reused view for copying data into the ring without allocation.
+	 */
+	private final ByteBuffer writeView;
+
+	/**
+	 * The number of bytes to buffer before playout starts.
+	 */
+	private final int prefill;
+
+
+	/**
+	 * Creates a new ring buffer with the given capacity and prefill level.
+	 * 10 ms of 48 kHz stereo 16-bit audio take 1920 bytes.
+	 *
+	 * @param capacity The capacity of the ring in bytes.
+	 * @param prefill  The number of bytes to buffer before playout starts.
+	 *
+	 * @throws IllegalArgumentException If the capacity is not positive or the
+	 *                                  prefill level exceeds the capacity.
+	 */
+	public AudioPlaybackRing(int capacity, int prefill) {
+		if (capacity < 1) {
+			throw new IllegalArgumentException("Capacity must be positive");
+		}
+		if (prefill < 0 || prefill > capacity) {
+			throw new IllegalArgumentException("Prefill must be between 0 and the capacity");
+		}
+
+		initialize(capacity, prefill);
+
+		this.prefill = prefill;
+
+		buffer = createBuffer().order(ByteOrder.nativeOrder());
+		writeView = buffer.duplicate().order(ByteOrder.nativeOrder());
+	}
+
+	/**
+	 * Returns a direct buffer backed by the ring memory. The byte at ring
+	 * position {@code p} is stored at index {@code p % getCapacity()}. Bytes
+	 * from the write position up to the read position plus the capacity may
+	 * be written and are published with {@link #setWritePosition(long)}.
+	 *
+	 * @return The ring memory in native byte order.
+	 */
+	public ByteBuffer getBuffer() {
+		return buffer;
+	}
+
+	/**
+	 * Returns the capacity of the ring in bytes.
+	 *
+	 * @return The ring capacity.
+	 */
+	public int getCapacity() {
+		return buffer.capacity();
+	}
+
+	/**
+	 * Returns the number of bytes buffered before playout starts.
+	 *
+	 * @return The prefill level in bytes.
+	 */
+	public int getPrefill() {
+		return prefill;
+	}
+
+	/**
+	 * Returns the number of bytes that can currently be written.
+	 *
+	 * @return The free space in bytes.
+	 */
+	public int free() {
+		return buffer.capacity() - (int) (getWritePosition() - getReadPosition());
+	}
+
+	/**
+	 * Copies as many bytes from the source buffer as fit into the ring and
+	 * publishes them to the playout thread. Write whole frames only.
+	 *
+	 * @param src The buffer holding the audio samples to play.
+	 *
+	 * @return The number of bytes copied.
+	 */
+	public int write(ByteBuffer src) {
+		requireNonNull(src);
+
+		final long writePosition = getWritePosition();
+		final int capacity = buffer.capacity();
+		final int used = (int) (writePosition - getReadPosition());
+		final int count = Math.min(capacity - used, src.remaining());
+
+		if (count == 0) {
+			return 0;
+		}
+
+		final int offset = (int) (writePosition % capacity);
+		final int first = Math.min(count, capacity - offset);
+		final int limit = src.limit();
+
+		writeView.limit(offset + first);
+		writeView.position(offset);
+		src.limit(src.position() + first);
+		writeView.put(src);
+
+		if (count > first) {
+			writeView.limit(count - first);
+			writeView.position(0);
+			src.limit(src.position() + count - first);
+			writeView.put(src);
+		}
+
+		src.limit(limit);
+
+		setWritePosition(writePosition + count);
+
+		return count;
+	}
+
+	/**
+	 * Returns the total number of bytes written into the ring. The value only
+	 * grows; it is not reduced modulo the capacity.
+	 *
+	 * @return The write position in bytes.
+	 */
+	public native long getWritePosition();
+
+	/**
+	 * Publishes ring memory up to the given position to the playout thread.
+	 * Use this method when writing directly into {@link #getBuffer()}.
+	 *
+	 * @param position The new write position, at most one capacity ahead of
+	 *                 the read position.
+	 */
+	public native void setWritePosition(long position);
+
+	/**
+	 * Returns the total number of bytes consumed by the playout thread.
+	 *
+	 * @return The read position in bytes.
+	 */
+	public native long getReadPosition();
+
+	/**
+	 * Returns the number of playout requests that could not be served in full
+	 * and were padded with silence.
+	 *
+	 * @return The number of underruns.
+	 */
+	public native long getUnderrunCount();
+
+	/**
+	 * Returns the sample rate requested by the playout thread.
+	 *
+	 * @return The sample rate in Hz, or 0 if no audio has been requested yet.
+	 */
+	public native int getSampleRate();
+
+	/**
+	 * Returns the number of channels requested by the playout thread.
+	 *
+	 * @return The number of channels, or 0 if no audio has been requested yet.
+	 */
+	public native int getChannels();
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(int capacity, int prefill);
+
+	private native ByteBuffer createBuffer();
+
+}
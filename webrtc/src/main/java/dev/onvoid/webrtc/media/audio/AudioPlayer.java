@@ -48,6 +48,11 @@ public class AudioPlayer {
 	 */
 	private AudioSource source;
 
+	/**
+	 * The ring buffer supplying audio frames instead of the source.
+	 */
+	private AudioPlaybackRing playbackRing;
+
 
 	/**
 	 * Creates a new AudioPlayer instance in a non-playing state.
@@ -74,6 +79,17 @@ public class AudioPlayer {
 		this.source = source;
 	}
 
+	/**
+	 * Assigns a ring buffer supplying audio data instead of the source. The
+	 * playout thread reads from the ring without calling into Java; the
+	 * application writes ahead into it.
+	 *
+	 * @param ring the ring buffer (may be null to use the source).
+	 */
+	public void setAudioPlaybackRing(AudioPlaybackRing ring) {
+		this.playbackRing = ring;
+	}
+
 	/**
 	 * Starts audio playout if not already running. This method is idempotent; subsequent
 	 * calls while already playing have no effect.
@@ -84,7 +100,12 @@ public class AudioPlayer {
 		if (playing.compareAndSet(false, true)) {
 			module = new AudioDeviceModule();
 			module.setPlayoutDevice(device);
-			module.setAudioSource(source);
+			if (playbackRing != null) {
+				module.setAudioPlaybackRing(playbackRing);
+			}
+			else {
+				module.setAudioSource(source);
+			}
 			module.initPlayout();
 			module.startPlayout();
 		}
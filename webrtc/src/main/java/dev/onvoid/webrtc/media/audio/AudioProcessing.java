@@ -16,9 +16,17 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static java.util.Objects.isNull;
+import static java.util.Objects.requireNonNull;
+
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 import dev.onvoid.webrtc.internal.NativeLoader;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 /**
  * AudioProcessing provides a collection of voice processing components designed
  * for real-time communications software. Accepts only linear PCM audio in
@@ -38,9 +46,26 @@ public class AudioProcessing extends DisposableNativeObject {
 	}
 
 
+	/** The maximum number of channels of remixed channel layouts. */
+	private static final int MAX_REMIX_CHANNELS = 8;
+
 	/** Cached statistics object to avoid recreation. */
 	private final AudioProcessingStats stats = new AudioProcessingStats();
 
+	/**
+	 * Reference to the native registered stream formats.
+	 */
+	@SuppressWarnings("unused")
+	private long streamHandle;
+
+	/** Registered formats of the forward stream. */
+	private AudioProcessingStreamConfig streamInput;
+	private AudioProcessingStreamConfig streamOutput;
+
+	/** Registered formats of the reverse stream. */
+	private AudioProcessingStreamConfig reverseInput;
+	private AudioProcessingStreamConfig reverseOutput;
+
 
 	/**
 	 * Creates a new instance of {@code AudioProcessing}. Make sure to call
@@ -79,6 +104,187 @@ public class AudioProcessing extends DisposableNativeObject {
 		return Math.max(nSamplesIn, nSamplesOut) * outputConfig.channels * 2;
 	}
 
+	/**
+	 * Registers the formats used by {@link #processStream(ByteBuffer,
+	 * ByteBuffer, int)}. The formats are kept natively, so that batches of
+	 * frames can be processed without passing the configs on every call.
+	 *
+	 * @param inputConfig  The config that describes the audio input format.
+	 * @param outputConfig The config that describes the desired audio output
+	 *                     format.
+	 *
+	 * @throws IllegalArgumentException If the channel layouts would need a
+	 *                                  remix of more than 8 channels.
+	 */
+	public void setStreamConfig(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		checkChannels(inputConfig, outputConfig);
+
+		setStreamConfigInternal(inputConfig, outputConfig);
+
+		streamInput = inputConfig;
+		streamOutput = outputConfig;
+	}
+
+	/**
+	 * Registers the formats used by {@link #processReverseStream(ByteBuffer,
+	 * ByteBuffer, int)}.
+	 *
+	 * @param inputConfig  The config that describes the audio input format.
+	 * @param outputConfig The config that describes the desired audio output
+	 *                     format.
+	 *
+	 * @throws IllegalArgumentException If the channel layouts would need a
+	 *                                  remix of more than 8 channels.
+	 *
+	 * @see #setStreamConfig(AudioProcessingStreamConfig, AudioProcessingStreamConfig)
+	 */
+	public void setReverseStreamConfig(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		checkChannels(inputConfig, outputConfig);
+
+		setReverseStreamConfigInternal(inputConfig, outputConfig);
+
+		reverseInput = inputConfig;
+		reverseOutput = outputConfig;
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of interleaved 16-bit PCM
+	 * audio in one call, using the formats registered with {@link
+	 * #setStreamConfig}. Samples are read from and written to the direct
+	 * buffers in native byte order, starting at their positions. The buffer
+	 * positions are not modified. {@code src} and {@code dest} may be the same
+	 * buffer if the input and output frame sizes are equal.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @throws IllegalStateException    If no stream config was registered.
+	 * @throws IllegalArgumentException If a buffer is not direct or too small.
+	 */
+	public int processStream(ByteBuffer src, ByteBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, streamInput, streamOutput, 2);
+
+		return processStreamDirect(src, src.position(), dest, dest.position(), frames);
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of interleaved 32-bit
+	 * float audio in the range [-1, 1], using the formats registered with
+	 * {@link #setStreamConfig}. The samples are passed to the float interface
+	 * of the audio processing, which avoids the conversion to and from 16-bit
+	 * samples. The buffer positions are not modified.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @throws IllegalStateException    If no stream config was registered.
+	 * @throws IllegalArgumentException If a buffer is not direct, not in native
+	 *                                  byte order or too small.
+	 */
+	public int processStream(FloatBuffer src, FloatBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, streamInput, streamOutput);
+
+		return processStreamFloat(src, src.position(), dest, dest.position(), frames, false);
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of planar 32-bit float
+	 * audio in the range [-1, 1], using the formats registered with {@link
+	 * #setStreamConfig}. Each 10 ms frame is stored as one block of samples per
+	 * channel, one channel after another. Planar frames are passed to the
+	 * audio processing in place, without any conversion.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @throws IllegalStateException    If no stream config was registered.
+	 * @throws IllegalArgumentException If a buffer is not direct, not in native
+	 *                                  byte order or too small.
+	 */
+	public int processStreamPlanar(FloatBuffer src, FloatBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, streamInput, streamOutput);
+
+		return processStreamFloat(src, src.position(), dest, dest.position(), frames, true);
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of the reverse direction
+	 * audio stream, using the formats registered with {@link
+	 * #setReverseStreamConfig}.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @throws IllegalStateException    If no reverse stream config was
+	 *                                  registered.
+	 * @throws IllegalArgumentException If a buffer is not direct or too small.
+	 *
+	 * @see #processStream(ByteBuffer, ByteBuffer, int)
+	 */
+	public int processReverseStream(ByteBuffer src, ByteBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, reverseInput, reverseOutput, 2);
+
+		return processReverseStreamDirect(src, src.position(), dest, dest.position(), frames);
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of interleaved 32-bit
+	 * float audio of the reverse direction audio stream, using the formats
+	 * registered with {@link #setReverseStreamConfig}.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @see #processStream(FloatBuffer, FloatBuffer, int)
+	 */
+	public int processReverseStream(FloatBuffer src, FloatBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, reverseInput, reverseOutput);
+
+		return processReverseStreamFloat(src, src.position(), dest, dest.position(), frames, false);
+	}
+
+	/**
+	 * Processes a batch of consecutive 10 ms frames of planar 32-bit float
+	 * audio of the reverse direction audio stream, using the formats
+	 * registered with {@link #setReverseStreamConfig}.
+	 *
+	 * @param src    The direct buffer with the input audio samples.
+	 * @param dest   The direct buffer for the processed audio samples.
+	 * @param frames The number of 10 ms frames to process.
+	 *
+	 * @return The success/error code. 0 if all frames were processed
+	 *         successfully, otherwise the code of the first frame that failed.
+	 *
+	 * @see #processStreamPlanar(FloatBuffer, FloatBuffer, int)
+	 */
+	public int processReverseStreamPlanar(FloatBuffer src, FloatBuffer dest, int frames) {
+		checkBuffers(src, dest, frames, reverseInput, reverseOutput);
+
+		return processReverseStreamFloat(src, src.position(), dest, dest.position(), frames, true);
+	}
+
 	/**
 	 * Set the {@link AudioProcessingConfig} to enable/disable processing
 	 * effects. Should be called prior processing, during processing may cause
@@ -125,6 +331,12 @@ public class AudioProcessing extends DisposableNativeObject {
 	 * Accepts and produces a 10 ms frame interleaved 16-bit PCM audio as
 	 * specified in {@code inputConfig} and {@code outputConfig}. {@code src}
 	 * and {@code dest} may use the same memory, if desired.
+	 * <p>
+	 * The input and output may have any channel layout. Mono input is
+	 * duplicated into all output channels without gain, other layouts are
+	 * remixed natively, e.g. stereo to quad or 5.1 to stereo. Remixing
+	 * supports up to 8 channels. The remixing state is kept per direction and
+	 * guarded, so frames may be processed from different threads.
 	 *
 	 * @param src          The input audio samples to process.
 	 * @param inputConfig  The config that describes the audio input format.
@@ -133,16 +345,25 @@ public class AudioProcessing extends DisposableNativeObject {
 	 * @param dest         The target buffer for processed audio samples.
 	 *
 	 * @return The success/error code. 0 if processed successfully.
+	 *
+	 * @throws IllegalArgumentException If the channel layouts would need a
+	 *                                  remix of more than 8 channels.
 	 */
-	public native int processStream(byte[] src,
+	public int processStream(byte[] src,
 			AudioProcessingStreamConfig inputConfig,
-			AudioProcessingStreamConfig outputConfig, byte[] dest);
+			AudioProcessingStreamConfig outputConfig, byte[] dest) {
+		checkChannels(inputConfig, outputConfig);
+
+		return processStreamArray(src, inputConfig, outputConfig, dest);
+	}
 
 	/**
 	 * Accepts and produces a 10 ms frame of interleaved 16-bit PCM audio for
 	 * the reverse direction audio stream as specified in {@code inputConfig}
 	 * and {@code outputConfig}. {@code src} and {@code dest} may use the same
-	 * memory, if desired.
+	 * memory, if desired. Channel layouts are remixed as in {@link
+	 * #processStream(byte[], AudioProcessingStreamConfig,
+	 * AudioProcessingStreamConfig, byte[])}.
 	 *
 	 * @param src          The input audio samples to process.
 	 * @param inputConfig  The config that describes the audio input format.
@@ -151,10 +372,17 @@ public class AudioProcessing extends DisposableNativeObject {
 	 * @param dest         The target buffer for processed audio samples.
 	 *
 	 * @return The success/error code. 0 if processed successfully.
+	 *
+	 * @throws IllegalArgumentException If the channel layouts would need a
+	 *                                  remix of more than 8 channels.
 	 */
-	public native int processReverseStream(byte[] src,
+	public int processReverseStream(byte[] src,
 			AudioProcessingStreamConfig inputConfig,
-			AudioProcessingStreamConfig outputConfig, byte[] dest);
+			AudioProcessingStreamConfig outputConfig, byte[] dest) {
+		checkChannels(inputConfig, outputConfig);
+
+		return processReverseStreamArray(src, inputConfig, outputConfig, dest);
+	}
 
 	@Override
 	public native void dispose();
@@ -163,4 +391,90 @@ public class AudioProcessing extends DisposableNativeObject {
 
 	private native void updateStats();
 
+	private native int processStreamArray(byte[] src,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig, byte[] dest);
+
+	private native int processReverseStreamArray(byte[] src,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig, byte[] dest);
+
+	private native int processStreamDirect(ByteBuffer src, int srcOffset,
+			ByteBuffer dest, int destOffset, int frames);
+
+	private native int processReverseStreamDirect(ByteBuffer src, int srcOffset,
+			ByteBuffer dest, int destOffset, int frames);
+
+	private native int processStreamFloat(FloatBuffer src, int srcOffset,
+			FloatBuffer dest, int destOffset, int frames, boolean planar);
+
+	private native int processReverseStreamFloat(FloatBuffer src, int srcOffset,
+			FloatBuffer dest, int destOffset, int frames, boolean planar);
+
+	private native void setStreamConfigInternal(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig);
+
+	private native void setReverseStreamConfigInternal(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig);
+
+	private static void checkChannels(AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		requireNonNull(inputConfig);
+		requireNonNull(outputConfig);
+
+		int inChannels = inputConfig.channels;
+		int outChannels = outputConfig.channels;
+
+		// Same layouts, mono input and mono output are not remixed.
+		if (inChannels == outChannels || inChannels == 1 || outChannels == 1) {
+			return;
+		}
+		if (Math.max(inChannels, outChannels) > MAX_REMIX_CHANNELS) {
+			throw new IllegalArgumentException(String.format(
+					"Cannot remix %d to %d channels, at most %d channels are supported",
+					inChannels, outChannels, MAX_REMIX_CHANNELS));
+		}
+	}
+
+	private static void checkBuffers(FloatBuffer src, FloatBuffer dest, int frames,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig) {
+		checkBuffers((Buffer) src, dest, frames, inputConfig, outputConfig, 1);
+
+		if (src.order() != ByteOrder.nativeOrder() || dest.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Audio buffers must be in native byte order");
+		}
+	}
+
+	private static void checkBuffers(Buffer src, Buffer dest, int frames,
+			AudioProcessingStreamConfig inputConfig,
+			AudioProcessingStreamConfig outputConfig, int elementsPerSample) {
+		requireNonNull(src);
+		requireNonNull(dest);
+
+		if (isNull(inputConfig) || isNull(outputConfig)) {
+			throw new IllegalStateException("No stream config registered");
+		}
+		if (!src.isDirect() || !dest.isDirect()) {
+			throw new IllegalArgumentException("Audio buffers must be direct buffers");
+		}
+		if (frames < 0) {
+			throw new IllegalArgumentException("Frame count must not be negative");
+		}
+
+		checkRemaining(src, frames, inputConfig, elementsPerSample);
+		checkRemaining(dest, frames, outputConfig, elementsPerSample);
+	}
+
+	private static void checkRemaining(Buffer buffer, int frames,
+			AudioProcessingStreamConfig config, int elementsPerSample) {
+		long required = (long) frames * (config.sampleRate / 100) * config.channels * elementsPerSample;
+
+		if (buffer.remaining() < required) {
+			throw new IllegalArgumentException(String.format(
+					"Audio buffer holds %d elements, %d required",
+					buffer.remaining(), required));
+		}
+	}
+
 }
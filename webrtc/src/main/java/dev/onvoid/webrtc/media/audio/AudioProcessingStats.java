@@ -23,6 +23,12 @@ package dev.onvoid.webrtc.media.audio;
  */
 public class AudioProcessingStats {
 
+	/**
+	 * Upper bounds in microseconds of the processing time histogram buckets.
+	 * The histograms have one more bucket, which counts all longer calls.
+	 */
+	public static final long[] PROCESSING_TIME_BOUNDS_US = { 50, 100, 200, 500, 1000, 2000, 5000 };
+
 	/**
 	 * AEC Statistic: ERL = 10log_10(P_far / P_echo)
 	 */
@@ -72,4 +78,89 @@ public class AudioProcessingStats {
 	 */
 	public double residualEchoLikelihoodRecentMax;
 
+	/**
+	 * The number of capture stream calls, one per 10 ms frame, including
+	 * those made by a PeerConnectionFactory that uses this instance.
+	 */
+	public long captureFrames;
+
+	/**
+	 * The capture frames processed per second since the previous statistics
+	 * update.
+	 */
+	public double captureFramesPerSecond;
+
+	/**
+	 * The mean wall time of a capture stream call, in microseconds.
+	 */
+	public double captureTimeMeanUs;
+
+	/**
+	 * The longest wall time of a capture stream call, in microseconds.
+	 */
+	public long captureTimeMaxUs;
+
+	/**
+	 * The number of capture stream calls per processing time bucket, see
+	 * {@link #PROCESSING_TIME_BOUNDS_US}.
+	 */
+	public final long[] captureTimeHistogram = new long[PROCESSING_TIME_BOUNDS_US.length + 1];
+
+	/**
+	 * The number of reverse (render) stream calls, one per 10 ms frame.
+	 */
+	public long renderFrames;
+
+	/**
+	 * The render frames processed per second since the previous statistics
+	 * update.
+	 */
+	public double renderFramesPerSecond;
+
+	/**
+	 * The mean wall time of a reverse stream call, in microseconds.
+	 */
+	public double renderTimeMeanUs;
+
+	/**
+	 * The longest wall time of a reverse stream call, in microseconds.
+	 */
+	public long renderTimeMaxUs;
+
+	/**
+	 * The number of reverse stream calls per processing time bucket, see
+	 * {@link #PROCESSING_TIME_BOUNDS_US}.
+	 */
+	public final long[] renderTimeHistogram = new long[PROCESSING_TIME_BOUNDS_US.length + 1];
+
+	/**
+	 * Whether the echo canceller is enabled.
+	 */
+	public boolean echoCancellerEnabled;
+
+	/**
+	 * Whether noise suppression is enabled.
+	 */
+	public boolean noiseSuppressionEnabled;
+
+	/**
+	 * Whether the legacy gain controller (AGC1) is enabled.
+	 */
+	public boolean gainControllerEnabled;
+
+	/**
+	 * Whether the digital gain controller (AGC2) is enabled.
+	 */
+	public boolean gainControllerDigitalEnabled;
+
+	/**
+	 * Whether the high-pass filter is enabled.
+	 */
+	public boolean highPassFilterEnabled;
+
+	/**
+	 * Whether capture level adjustment is enabled.
+	 */
+	public boolean captureLevelAdjustmentEnabled;
+
 }
@@ -39,6 +39,9 @@ public class AudioRecorder {
 	/** The sink receiving captured audio data. */
 	private AudioSink sink;
 
+	/** The ring buffer receiving captured audio data instead of the sink. */
+	private AudioCaptureRing captureRing;
+
 
 	/**
 	 * Creates a new AudioRecorder with an inactive capture state.
@@ -65,6 +68,17 @@ public class AudioRecorder {
 		this.sink = sink;
 	}
 
+	/**
+	 * Set a ring buffer that receives captured audio frames instead of the
+	 * sink. The capture thread writes into the ring without calling into Java;
+	 * the application drains it at its own cadence.
+	 *
+	 * @param ring the ring buffer, or null to deliver frames to the sink.
+	 */
+	public void setAudioCaptureRing(AudioCaptureRing ring) {
+		this.captureRing = ring;
+	}
+
 	/**
 	 * Start recording if not already active. Initializes and starts the underlying
 	 * AudioDeviceModule.
@@ -73,7 +87,12 @@ public class AudioRecorder {
 		if (capturing.compareAndSet(false, true)) {
 			module = new AudioDeviceModule();
 			module.setRecordingDevice(device);
-			module.setAudioSink(sink);
+			if (captureRing != null) {
+				module.setAudioCaptureRing(captureRing);
+			}
+			else {
+				module.setAudioSink(sink);
+			}
 			module.initRecording();
 			module.startRecording();
 		}
@@ -21,13 +21,28 @@ import static java.util.Objects.nonNull;
 
 import dev.onvoid.webrtc.media.MediaStreamTrack;
 
+import java.util.Collections;
 import java.util.IdentityHashMap;
 import java.util.Map;
+import java.util.Set;
 
 public class AudioTrack extends MediaStreamTrack {
 
+	/** The number of values per track written by {@link #pollLevels}. */
+	public static final int LEVEL_VALUES = 3;
+
+	/** Guards the level meter handles of all tracks against concurrent polling. */
+	private static final Object LEVEL_METER_LOCK = new Object();
+
 	private final Map<AudioTrackSink, Long> sinks = new IdentityHashMap<>();
 
+	private final Map<AudioTrackDirectSink, Long> directSinks = new IdentityHashMap<>();
+
+	private final Set<AudioTrackRecorder> recorders = Collections.newSetFromMap(new IdentityHashMap<>());
+
+	@SuppressWarnings("unused")
+	private long levelMeterHandle;
+
 
 	private AudioTrack() {
 		super();
@@ -41,6 +56,20 @@ public class AudioTrack extends MediaStreamTrack {
 
 		sinks.clear();
 
+		for (long nativeSink : directSinks.values()) {
+			removeDirectSinkInternal(nativeSink);
+		}
+
+		directSinks.clear();
+
+		for (AudioTrackRecorder recorder : recorders) {
+			removeRecorderInternal(recorder);
+		}
+
+		recorders.clear();
+
+		disableLevelMeter();
+
 		super.dispose();
 	}
 
@@ -78,6 +107,137 @@ public class AudioTrack extends MediaStreamTrack {
 		}
 	}
 
+	/**
+	 * Adds an AudioTrackDirectSink to the track. The sink receives audio
+	 * through a single reused direct buffer, which avoids allocating a new
+	 * array for every chunk of audio.
+	 *
+	 * @param sink The audio sink that will receive audio data from the track.
+	 */
+	public void addDirectSink(AudioTrackDirectSink sink) {
+		if (isNull(sink)) {
+			throw new NullPointerException();
+		}
+		if (directSinks.containsKey(sink)) {
+			return;
+		}
+
+		final long nativeSink = addDirectSinkInternal(sink);
+
+		directSinks.put(sink, nativeSink);
+	}
+
+	/**
+	 * Removes an AudioTrackDirectSink from the track. If the sink was not
+	 * attached to the track, this is a no-op.
+	 */
+	public void removeDirectSink(AudioTrackDirectSink sink) {
+		if (isNull(sink)) {
+			throw new NullPointerException();
+		}
+
+		final Long nativeSink = directSinks.remove(sink);
+
+		if (nonNull(nativeSink)) {
+			removeDirectSinkInternal(nativeSink);
+		}
+	}
+
+	/**
+	 * Adds an AudioTrackRecorder to the track. The recorder writes the audio
+	 * of the track to a file on a native background thread. A recorder may
+	 * be added to only one track.
+	 *
+	 * @param recorder The recorder that will receive audio data from the
+	 *                 track.
+	 */
+	public void addRecorder(AudioTrackRecorder recorder) {
+		if (isNull(recorder)) {
+			throw new NullPointerException();
+		}
+		if (!recorders.add(recorder)) {
+			return;
+		}
+
+		addRecorderInternal(recorder);
+	}
+
+	/**
+	 * Removes an AudioTrackRecorder from the track. If the recorder was not
+	 * attached to the track, this is a no-op. The recorder keeps its file open
+	 * until it is disposed.
+	 */
+	public void removeRecorder(AudioTrackRecorder recorder) {
+		if (isNull(recorder)) {
+			throw new NullPointerException();
+		}
+
+		if (recorders.remove(recorder)) {
+			removeRecorderInternal(recorder);
+		}
+	}
+
+	/**
+	 * Attaches a native level meter to the track. The meter measures the audio
+	 * on the audio thread, so the levels of local and remote tracks can be read
+	 * with {@link #pollLevels} without passing any audio to Java. If a meter is
+	 * already attached, this is a no-op.
+	 */
+	public void enableLevelMeter() {
+		synchronized (LEVEL_METER_LOCK) {
+			if (levelMeterHandle == 0) {
+				levelMeterHandle = addLevelMeterInternal();
+			}
+		}
+	}
+
+	/**
+	 * Detaches the level meter from the track. If no meter is attached, this
+	 * is a no-op.
+	 */
+	public void disableLevelMeter() {
+		synchronized (LEVEL_METER_LOCK) {
+			if (levelMeterHandle != 0) {
+				removeLevelMeterInternal(levelMeterHandle);
+
+				levelMeterHandle = 0;
+			}
+		}
+	}
+
+	/**
+	 * Reads the levels of many tracks in a single native call. For each track
+	 * {@link #LEVEL_VALUES} values are written to the output array, starting
+	 * at {@code i * LEVEL_VALUES} for the track at index {@code i}:
+	 * <ol>
+	 *     <li>The RMS level of the last 10 ms of audio in the range [0, 1].</li>
+	 *     <li>The peak level since the previous poll in the range [0, 1].</li>
+	 *     <li>The short-term loudness, the mean square level of the last
+	 *     400 ms in dBFS.</li>
+	 * </ol>
+	 * Tracks without a level meter, and {@code null} entries, are reported as
+	 * silence with a loudness of -100 dBFS.
+	 *
+	 * @param tracks The tracks to read the levels of.
+	 * @param out    The array to receive the levels.
+	 *
+	 * @throws IllegalArgumentException if the output array is too small.
+	 */
+	public static void pollLevels(AudioTrack[] tracks, float[] out) {
+		if (isNull(tracks) || isNull(out)) {
+			throw new NullPointerException();
+		}
+		if (out.length < tracks.length * LEVEL_VALUES) {
+			throw new IllegalArgumentException(String.format(
+					"Insufficient output length: %d vs. %d", out.length,
+					tracks.length * LEVEL_VALUES));
+		}
+
+		synchronized (LEVEL_METER_LOCK) {
+			pollLevelsInternal(tracks, out);
+		}
+	}
+
 	/**
 	 * Get the signal level from the audio track.
 	 *
@@ -89,4 +249,18 @@ public class AudioTrack extends MediaStreamTrack {
 
 	private native void removeSinkInternal(long sinkHandle);
 
+	private native long addDirectSinkInternal(AudioTrackDirectSink sink);
+
+	private native void removeDirectSinkInternal(long sinkHandle);
+
+	private native void addRecorderInternal(AudioTrackRecorder recorder);
+
+	private native void removeRecorderInternal(AudioTrackRecorder recorder);
+
+	private native long addLevelMeterInternal();
+
+	private native void removeLevelMeterInternal(long meterHandle);
+
+	private static native void pollLevelsInternal(AudioTrack[] tracks, float[] out);
+
 }
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Receives audio from an {@link AudioTrack} through a reused direct buffer.
+ * Unlike {@link AudioTrackSink}, which receives a new array for every chunk,
+ * the same buffer is overwritten in place, so that steady-state delivery does
+ * not allocate. The buffer is only replaced when the chunk size changes.
+ *
+ * @see AudioTrack#addDirectSink(AudioTrackDirectSink)
+ */
+public interface AudioTrackDirectSink {
+
+	/**
+	 * Called for every chunk of audio, typically every 10 ms. The buffer holds
+	 * the interleaved PCM samples in native byte order, with the position set
+	 * to zero and the limit to the size of the chunk. The buffer is only valid
+	 * during this call and must not be retained; copy the data if it is needed
+	 * afterwards.
+	 *
+	 * @param data          The buffer holding the audio samples.
+	 * @param bitsPerSample The number of bits per sample.
+	 * @param sampleRate    The sample rate in Hz.
+	 * @param channels      The number of channels.
+	 * @param frames        The number of frames per channel.
+	 */
+	void onData(ByteBuffer data, int bitsPerSample, int sampleRate, int channels, int frames);
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+/**
+ * Records the audio of an {@link AudioTrack} into a WAV or raw PCM file
+ * without passing the audio through the JVM. The audio thread only copies
+ * each chunk into a native ring buffer; a background writer thread, shared by
+ * all recorders, writes the buffered audio in batches. This keeps the cost per
+ * recording low enough to record hundreds of tracks at the same time.
+ * <p>
+ * The sample rate and channel count of the file are taken from the first
+ * chunk the track delivers. Only 16-bit audio is recorded. Chunks that do not
+ * match the format, or that do not fit into the buffer because the writer
+ * thread fell behind, are dropped and counted.
+ * <p>
+ * Remove the recorder from all tracks before disposing it. Disposing writes
+ * the remaining audio and closes the file.
+ *
+ * @see AudioTrack#addRecorder(AudioTrackRecorder)
+ */
+public class AudioTrackRecorder extends DisposableNativeObject {
+
+	/**
+	 * The format of the recorded file.
+	 */
+	public enum FileFormat {
+
+		/** WAV file with a header describing the stream format. */
+		WAV,
+
+		/** Headerless interleaved 16-bit PCM in native byte order. */
+		RAW
+
+	}
+
+
+	/**
+	 * Creates a new recorder that writes to the given file, buffering up to
+	 * two seconds of 48 kHz stereo audio.
+	 *
+	 * @param fileName The path of the file to write.
+	 * @param format   The format of the file.
+	 */
+	public AudioTrackRecorder(String fileName, FileFormat format) {
+		this(fileName, format, 2000);
+	}
+
+	/**
+	 * Creates a new recorder that writes to the given file. The buffer must
+	 * hold the audio that arrives between two writes of the background
+	 * thread, which runs every 100 ms.
+	 *
+	 * @param fileName     The path of the file to write.
+	 * @param format       The format of the file.
+	 * @param bufferMillis The buffer size in milliseconds of 48 kHz stereo
+	 *                     audio, at least 200.
+	 *
+	 * @throws IllegalArgumentException If the buffer size is too small.
+	 */
+	public AudioTrackRecorder(String fileName, FileFormat format, int bufferMillis) {
+		requireNonNull(fileName);
+		requireNonNull(format);
+
+		if (bufferMillis < 200) {
+			throw new IllegalArgumentException("Buffer must hold at least 200 ms");
+		}
+
+		// 48 kHz stereo 16-bit audio requires 192 bytes per millisecond.
+		initialize(fileName, format == FileFormat.WAV, bufferMillis * 192);
+	}
+
+	/**
+	 * Returns the number of audio frames written to the file so far.
+	 *
+	 * @return The number of written frames.
+	 */
+	public native long getWrittenFrames();
+
+	/**
+	 * Returns the number of audio chunks that were dropped, either because
+	 * the buffer was full or because their format did not match the file.
+	 *
+	 * @return The number of dropped chunks.
+	 */
+	public native long getDroppedCount();
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(String fileName, boolean wav, int bufferSize);
+
+}
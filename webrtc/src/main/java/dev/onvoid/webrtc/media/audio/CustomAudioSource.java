@@ -18,6 +18,10 @@ package dev.onvoid.webrtc.media.audio;
 
 import dev.onvoid.webrtc.media.SyncClock;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 /**
  * Custom implementation of an audio source for WebRTC that allows pushing audio data
  * from external sources directly to the WebRTC audio pipeline.
@@ -47,7 +51,182 @@ public class CustomAudioSource extends AudioTrackSource {
 	}
 
 	/**
-	 * Pushes audio data to be processed by this audio source.
+	 * Sets the format in which pushed audio is delivered to the audio track.
+	 * Audio is converted to 16-bit, and audio with a different sample rate or
+	 * channel count is resampled and remixed natively. Pushed chunks of any
+	 * size are regrouped into 10 ms chunks for the conversion, so converted
+	 * audio is delivered in 10 ms frames. The input sample rate must be a
+	 * multiple of 100 Hz.
+	 *
+	 * @param sampleRate The target sample rate in Hz, or 0 to disable conversion.
+	 * @param channels   The target number of channels.
+	 *
+	 * @throws IllegalArgumentException if the format is invalid.
+	 */
+	public void setTargetFormat(int sampleRate, int channels) {
+		if (sampleRate < 0) {
+			throw new IllegalArgumentException("Sample rate must not be negative");
+		}
+		if (sampleRate > 0 && channels < 1) {
+			throw new IllegalArgumentException("Channel count must be positive");
+		}
+
+		setTargetFormatInternal(sampleRate, channels);
+	}
+
+	/**
+	 * Starts delivering pushed audio in exact 10 ms frames at a steady
+	 * cadence. Pushed audio of any chunk size is buffered natively and
+	 * emitted by a pacer thread on the source's clock, which smooths out
+	 * bursts and irregular chunk sizes from decoders. If less than 10 ms of
+	 * audio is buffered when a frame is due, the frame is padded with silence
+	 * and counted as underrun. Audio that does not fit into the buffer is
+	 * dropped and counted as overrun.
+	 * <p>
+	 * The given format also becomes the target format, so audio of any sample
+	 * format is converted to 16-bit, resampled and remixed before it is paced.
+	 *
+	 * @param sampleRate   The sample rate of the paced audio in Hz. Must be a
+	 *                     multiple of 100.
+	 * @param channels     The number of channels of the paced audio.
+	 * @param bufferMillis The capacity of the pacing buffer in milliseconds.
+	 *
+	 * @throws IllegalArgumentException if the format or buffer size is invalid.
+	 */
+	public void startPacing(int sampleRate, int channels, int bufferMillis) {
+		if (sampleRate <= 0 || sampleRate % 100 != 0) {
+			throw new IllegalArgumentException(
+					"Sample rate must be a positive multiple of 100");
+		}
+		if (channels < 1) {
+			throw new IllegalArgumentException("Channel count must be positive");
+		}
+		if (bufferMillis < 10) {
+			throw new IllegalArgumentException(
+					"Buffer must hold at least 10 ms of audio");
+		}
+
+		startPacingInternal(sampleRate, channels, bufferMillis);
+	}
+
+	/**
+	 * Stops pacing. Buffered audio that has not been delivered yet is
+	 * discarded and pushed audio is delivered directly again.
+	 */
+	public native void stopPacing();
+
+	/**
+	 * Returns the number of frames currently waiting in the pacing buffer.
+	 *
+	 * @return The buffered frame count, or 0 if pacing is not active.
+	 */
+	public native int getPacingBufferedFrames();
+
+	/**
+	 * Returns the number of paced frames that had to be padded with silence
+	 * because not enough audio was buffered.
+	 *
+	 * @return The underrun count, or 0 if pacing is not active.
+	 */
+	public native long getPacingUnderrunCount();
+
+	/**
+	 * Returns the number of pushes that did not entirely fit into the pacing
+	 * buffer.
+	 *
+	 * @return The overrun count, or 0 if pacing is not active.
+	 */
+	public native long getPacingOverrunCount();
+
+	/**
+	 * Pushes audio data from a direct buffer to be processed by this audio
+	 * source. The data is read in place, starting at the buffer's position,
+	 * without copying it to the Java heap. The buffer's position is not
+	 * modified.
+	 *
+	 * @param audioData     The direct buffer with the raw audio data.
+	 * @param bitsPerSample The number of bits per sample (e.g., 8, 16, 32).
+	 * @param sampleRate    The sample rate of the audio in Hz (e.g., 44100, 48000).
+	 * @param channels      The number of audio channels (1 for mono, 2 for stereo).
+	 * @param frameCount    The number of frames in the provided audio data.
+	 *
+	 * @throws IllegalArgumentException if the buffer is not direct, the format
+	 *                                  is invalid or the buffer holds less
+	 *                                  data than required.
+	 */
+	public void pushAudio(ByteBuffer audioData, int bitsPerSample, int sampleRate,
+						  int channels, int frameCount) {
+		if (!audioData.isDirect()) {
+			throw new IllegalArgumentException("Audio data must be a direct buffer");
+		}
+		if (bitsPerSample <= 0 || bitsPerSample % 8 != 0) {
+			throw new IllegalArgumentException("Bits per sample must be a positive multiple of 8");
+		}
+
+		checkFormat(channels, frameCount);
+		checkRemaining(audioData.remaining(), (long) frameCount * channels * (bitsPerSample / 8));
+
+		pushAudioDirect(audioData, audioData.position(), bitsPerSample, sampleRate,
+				channels, frameCount);
+	}
+
+	/**
+	 * Pushes 32-bit float audio data to be processed by this audio source.
+	 * Samples are expected in the range [-1, 1] and are converted natively
+	 * to 16-bit.
+	 *
+	 * @param audioData  The interleaved float samples.
+	 * @param sampleRate The sample rate of the audio in Hz (e.g., 44100, 48000).
+	 * @param channels   The number of audio channels (1 for mono, 2 for stereo).
+	 * @param frameCount The number of frames in the provided audio data.
+	 *
+	 * @throws IllegalArgumentException if the format is invalid or the array
+	 *                                  holds less data than required.
+	 */
+	public void pushAudio(float[] audioData, int sampleRate, int channels,
+						  int frameCount) {
+		checkFormat(channels, frameCount);
+		checkRemaining(audioData.length, (long) frameCount * channels);
+
+		pushAudioFloat(audioData, sampleRate, channels, frameCount);
+	}
+
+	/**
+	 * Pushes 32-bit float audio data from a direct buffer to be processed by
+	 * this audio source. Samples are expected in the range [-1, 1] and are
+	 * read in place, starting at the buffer's position. The buffer's position
+	 * is not modified.
+	 *
+	 * @param audioData  The direct buffer in native byte order with the
+	 *                   interleaved float samples.
+	 * @param sampleRate The sample rate of the audio in Hz (e.g., 44100, 48000).
+	 * @param channels   The number of audio channels (1 for mono, 2 for stereo).
+	 * @param frameCount The number of frames in the provided audio data.
+	 *
+	 * @throws IllegalArgumentException if the buffer is not direct, not in
+	 *                                  native byte order, the format is
+	 *                                  invalid or the buffer holds less data
+	 *                                  than required.
+	 */
+	public void pushAudio(FloatBuffer audioData, int sampleRate, int channels,
+						  int frameCount) {
+		if (!audioData.isDirect()) {
+			throw new IllegalArgumentException("Audio data must be a direct buffer");
+		}
+		if (audioData.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Audio data must be in native byte order");
+		}
+
+		checkFormat(channels, frameCount);
+		checkRemaining(audioData.remaining(), (long) frameCount * channels);
+
+		pushAudioFloatDirect(audioData, audioData.position(), sampleRate, channels,
+				frameCount);
+	}
+
+	/**
+	 * Pushes audio data to be processed by this audio source. The audio data
+	 * is converted to the target format, if one has been set.
 	 *
 	 * @param audioData       The raw audio data bytes to process.
 	 * @param bits_per_sample The number of bits per sample (e.g., 8, 16, 32).
@@ -65,6 +244,39 @@ public class CustomAudioSource extends AudioTrackSource {
 	 */
 	public native void dispose();
 
+	private static void checkFormat(int channels, int frameCount) {
+		if (channels < 1) {
+			throw new IllegalArgumentException("Channel count must be positive");
+		}
+		if (frameCount < 1) {
+			throw new IllegalArgumentException("Frame count must be positive");
+		}
+	}
+
+	private static void checkRemaining(int available, long required) {
+		if (available < required) {
+			throw new IllegalArgumentException(String.format(
+					"Audio data holds %d elements, %d required", available,
+					required));
+		}
+	}
+
+	private native void pushAudioDirect(ByteBuffer audioData, int offset,
+										int bitsPerSample, int sampleRate,
+										int channels, int frameCount);
+
+	private native void pushAudioFloat(float[] audioData, int sampleRate,
+									   int channels, int frameCount);
+
+	private native void pushAudioFloatDirect(FloatBuffer audioData, int offset,
+											 int sampleRate, int channels,
+											 int frameCount);
+
+	private native void setTargetFormatInternal(int sampleRate, int channels);
+
+	private native void startPacingInternal(int sampleRate, int channels,
+											int bufferMillis);
+
 	/**
 	 * Initializes the native resources required by this audio source.
 	 */
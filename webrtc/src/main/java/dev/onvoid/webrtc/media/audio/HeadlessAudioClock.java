@@ -0,0 +1,44 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+/**
+ * Selects the clock that drives the 10 ms playout and capture ticks of a
+ * {@link HeadlessAudioDeviceModule}.
+ */
+public enum HeadlessAudioClock {
+
+	/**
+	 * The module runs its own realtime playout and capture threads.
+	 */
+	REALTIME,
+
+	/**
+	 * The module is ticked by a single process-wide timing thread that is
+	 * shared by all modules using this clock. Thread count and wake-ups stay
+	 * constant as modules are added.
+	 */
+	SHARED,
+
+	/**
+	 * The module has no timing thread. Ticks are only processed by calls to
+	 * {@link HeadlessAudioDeviceModule#advance(int)}, which allows offline
+	 * jobs to run faster than realtime.
+	 */
+	MANUAL
+
+}
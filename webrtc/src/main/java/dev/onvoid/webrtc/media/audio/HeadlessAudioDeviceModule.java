@@ -16,6 +16,8 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static java.util.Objects.requireNonNull;
+
 /**
  * Convenience AudioDeviceModule that uses the dummy audio layer. This avoids touching
  * real OS audio devices while still enabling the push and pull of audio via the WebRTC
@@ -26,15 +28,166 @@ package dev.onvoid.webrtc.media.audio;
 public class HeadlessAudioDeviceModule extends AudioDeviceModuleBase {
 
 	/**
-	 * Constructs a HeadlessAudioDeviceModule.
+	 * The clock that drives this module.
+	 */
+	private final HeadlessAudioClock clock;
+
+	/**
+	 * The ring buffer receiving the mixed playout audio, if set.
+	 */
+	private AudioCaptureRing playoutTap;
+
+	/**
+	 * Constructs a HeadlessAudioDeviceModule that runs its own realtime
+	 * playout and capture threads.
 	 */
 	public HeadlessAudioDeviceModule() {
-		initialize();
+		this(HeadlessAudioClock.REALTIME);
+	}
+
+	/**
+	 * Constructs a HeadlessAudioDeviceModule whose 10 ms playout and capture
+	 * ticks are driven by the given clock.
+	 *
+	 * @param clock The clock that drives this module.
+	 *
+	 * @throws NullPointerException if the provided clock is null.
+	 */
+	public HeadlessAudioDeviceModule(HeadlessAudioClock clock) {
+		requireNonNull(clock);
+
+		this.clock = clock;
+
+		initialize(clock);
+	}
+
+	/**
+	 * Returns the clock that drives this module.
+	 *
+	 * @return The clock of this module.
+	 */
+	public HeadlessAudioClock getClock() {
+		return clock;
+	}
+
+	/**
+	 * Processes the given number of 10 ms ticks on the calling thread. Each
+	 * tick first captures and then plays out one 10 ms chunk, keeping both
+	 * directions in lockstep. The call returns as soon as the ticks have been
+	 * processed, so calling it in a loop runs the pipeline as fast as
+	 * possible.
+	 *
+	 * @param ticks The number of ticks to process.
+	 *
+	 * @return The number of processed ticks, which is less than requested if
+	 *         neither playout nor recording has been started.
+	 *
+	 * @throws IllegalStateException    if this module does not use the
+	 *                                  {@link HeadlessAudioClock#MANUAL} clock.
+	 * @throws IllegalArgumentException if the tick count is negative.
+	 */
+	public int advance(int ticks) {
+		if (clock != HeadlessAudioClock.MANUAL) {
+			throw new IllegalStateException("Module does not use a manual clock");
+		}
+		if (ticks < 0) {
+			throw new IllegalArgumentException("Tick count must not be negative");
+		}
+
+		return advanceInternal(ticks);
+	}
+
+	/**
+	 * Sets a ring buffer that receives the mixed playout audio of all remote
+	 * tracks. The module passes each 10 ms chunk it pulls for playout to the
+	 * ring, at the cost of a single copy, instead of discarding it. This
+	 * replaces any previously set playout tap. The ring must stay alive until
+	 * the tap is removed or this module is disposed.
+	 *
+	 * @param ring The ring buffer to receive the mixed playout audio.
+	 *
+	 * @throws NullPointerException if the provided ring is null.
+	 */
+	public void setPlayoutTap(AudioCaptureRing ring) {
+		requireNonNull(ring);
+
+		setPlayoutTapInternal(ring);
+
+		playoutTap = ring;
+	}
+
+	/**
+	 * Writes the mixed playout audio of all remote tracks to a WAV file in
+	 * the playout format of this module. This replaces any previously set
+	 * playout tap. The file is closed when the tap is removed or replaced, or
+	 * when this module is disposed. The channel count of this module cannot
+	 * change while the file is open, since the WAV header is written for a
+	 * fixed format.
+	 *
+	 * @param fileName The path of the WAV file to write.
+	 *
+	 * @throws NullPointerException if the provided file name is null.
+	 */
+	public void setPlayoutTapFile(String fileName) {
+		requireNonNull(fileName);
+
+		setPlayoutTapFileInternal(fileName);
+
+		playoutTap = null;
 	}
 
+	/**
+	 * Removes the playout tap. Mixed playout audio is discarded again.
+	 */
+	public void removePlayoutTap() {
+		setPlayoutTapInternal(null);
+
+		playoutTap = null;
+	}
+
+	@Override
+	public void dispose() {
+		removePlayoutTap();
+
+		super.dispose();
+	}
+
+	/**
+	 * Returns the number of 10 ms ticks this module has processed. In
+	 * {@link HeadlessAudioClock#REALTIME} mode playout and capture ticks are
+	 * counted separately.
+	 *
+	 * @return The number of processed ticks.
+	 */
+	public native long getTickCount();
+
+	/**
+	 * Returns the average delay between the time a tick was due and the time
+	 * it was processed.
+	 *
+	 * @return The average tick lateness in microseconds.
+	 */
+	public native long getAverageTickLateness();
+
+	/**
+	 * Returns the largest delay between the time a tick was due and the time
+	 * it was processed.
+	 *
+	 * @return The maximum tick lateness in microseconds.
+	 */
+	public native long getMaxTickLateness();
+
+	private native int advanceInternal(int ticks);
+
+	private native void setPlayoutTapInternal(AudioCaptureRing ring);
+
+	private native void setPlayoutTapFileInternal(String fileName);
+
 	/**
 	 * Initializes the native audio resources. Called during construction of the module.
+	 *
+	 * @param clock The clock that drives this module.
 	 */
-	private native void initialize();
+	private native void initialize(HeadlessAudioClock clock);
 
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
+/**
+ * Stateful resampler for interleaved audio of arbitrary chunk sizes, e.g. the
+ * 1024-frame chunks produced by many decoders. Unlike {@link AudioResampler},
+ * which requires 10 ms chunks, input of any length is accepted. The filter
+ * state and leftover samples are kept natively between calls, so consecutive
+ * chunks are resampled as one continuous stream. Samples are either 16-bit
+ * PCM samples in native byte order or 32-bit float samples.
+ */
+public class StreamingAudioResampler extends DisposableNativeObject {
+
+	/** The number of interleaved channels. */
+	private final int channels;
+
+
+	/**
+	 * Creates a new {@code StreamingAudioResampler}.
+	 *
+	 * @param srcSampleRate The sampling frequency of the input signal.
+	 * @param dstSampleRate The sampling frequency of the output signal.
+	 * @param channels      The number of interleaved audio channels.
+	 *
+	 * @throws IllegalArgumentException if a sample rate or the channel count
+	 *                                  is not positive.
+	 */
+	public StreamingAudioResampler(int srcSampleRate, int dstSampleRate, int channels) {
+		if (srcSampleRate <= 0 || dstSampleRate <= 0) {
+			throw new IllegalArgumentException("Sample rates must be positive");
+		}
+		if (channels <= 0) {
+			throw new IllegalArgumentException("Channel count must be positive");
+		}
+
+		this.channels = channels;
+
+		initialize(srcSampleRate, dstSampleRate, channels);
+	}
+
+	/**
+	 * Resamples all remaining 16-bit samples of the source buffer and writes
+	 * as many resampled frames as are available and fit into the destination
+	 * buffer. Frames that do not fit are kept and written by the next call.
+	 * The source position is advanced to its limit and the destination
+	 * position by the number of bytes written.
+	 *
+	 * @param src The direct buffer with the audio samples to resample.
+	 * @param dst The direct buffer for resampled audio samples.
+	 *
+	 * @return The number of frames written to the destination buffer.
+	 *
+	 * @throws IllegalArgumentException if a buffer is not direct or the source
+	 *                                  does not hold whole frames.
+	 */
+	public int resample(ByteBuffer src, ByteBuffer dst) {
+		final int frameSize = channels * 2;
+
+		checkBuffers(src, dst, frameSize);
+
+		int srcFrames = src.remaining() / frameSize;
+		int dstFrames = dst.remaining() / frameSize;
+		int written = resampleDirect(src, src.position(), srcFrames, dst,
+				dst.position(), dstFrames);
+
+		src.position(src.limit());
+		dst.position(dst.position() + written * frameSize);
+
+		return written;
+	}
+
+	/**
+	 * Resamples all remaining float samples of the source buffer and writes as
+	 * many resampled frames as are available and fit into the destination
+	 * buffer. Frames that do not fit are kept and written by the next call.
+	 * The source position is advanced to its limit and the destination
+	 * position by the number of samples written.
+	 *
+	 * @param src The direct buffer with the audio samples to resample.
+	 * @param dst The direct buffer for resampled audio samples.
+	 *
+	 * @return The number of frames written to the destination buffer.
+	 *
+	 * @throws IllegalArgumentException if a buffer is not direct, not in native
+	 *                                  byte order or the source does not hold
+	 *                                  whole frames.
+	 */
+	public int resample(FloatBuffer src, FloatBuffer dst) {
+		checkBuffers(src, dst, channels);
+
+		if (src.order() != ByteOrder.nativeOrder() || dst.order() != ByteOrder.nativeOrder()) {
+			throw new IllegalArgumentException("Audio buffers must be in native byte order");
+		}
+
+		int srcFrames = src.remaining() / channels;
+		int dstFrames = dst.remaining() / channels;
+		int written = resampleFloatDirect(src, src.position(), srcFrames, dst,
+				dst.position(), dstFrames);
+
+		src.position(src.limit());
+		dst.position(dst.position() + written * channels);
+
+		return written;
+	}
+
+	/**
+	 * Returns the number of resampled frames that are kept natively because
+	 * they did not fit into the destination buffer of the last call. An empty
+	 * source buffer can be passed to {@code resample} to fetch them.
+	 *
+	 * @return The number of pending output frames.
+	 */
+	public native int getAvailableFrames();
+
+	/**
+	 * Discards all pending input and output samples and clears the filter
+	 * state, e.g. before resampling an unrelated stream.
+	 */
+	public native void reset();
+
+	@Override
+	public native void dispose();
+
+	private native void initialize(int srcSampleRate, int dstSampleRate, int channels);
+
+	private native int resampleDirect(ByteBuffer src, int srcOffset, int srcFrames,
+			ByteBuffer dst, int dstOffset, int dstFrames);
+
+	private native int resampleFloatDirect(FloatBuffer src, int srcOffset, int srcFrames,
+			FloatBuffer dst, int dstOffset, int dstFrames);
+
+	private static void checkBuffers(Buffer src, Buffer dst, int frameSize) {
+		if (!src.isDirect() || !dst.isDirect()) {
+			throw new IllegalArgumentException("Audio buffers must be direct buffers");
+		}
+		if (src.remaining() % frameSize != 0) {
+			throw new IllegalArgumentException(String.format(
+					"Input length is not a multiple of the frame size: %d vs. %d",
+					src.remaining(), frameSize));
+		}
+	}
+
+}
@@ -16,8 +16,12 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static java.util.Objects.requireNonNull;
+
 import dev.onvoid.webrtc.internal.DisposableNativeObject;
 
+import java.nio.ByteBuffer;
+
 /**
  * A voice activity detector that analyzes audio data chunks to determine the probability of voice presence in the
  * audio stream.
@@ -51,6 +55,43 @@ public class VoiceActivityDetector extends DisposableNativeObject {
 	 */
 	public native float getLastVoiceProbability();
 
+	/**
+	 * Splits a whole recording into speech segments in a single native call.
+	 * The voice activity is detected in 10 ms frames, and the hangover and
+	 * minimum speech duration of the parameters are applied natively. The
+	 * remaining mono 16-bit samples in native byte order of the direct buffer
+	 * are analyzed. The buffer position is not modified.
+	 *
+	 * @param pcm        The direct buffer with mono audio samples.
+	 * @param sampleRate The sample rate of the audio, a multiple of 100 Hz.
+	 * @param params     The segmentation parameters.
+	 *
+	 * @return The start and end offsets of the speech segments in samples,
+	 * relative to the buffer position, as consecutive pairs.
+	 *
+	 * @throws IllegalArgumentException if the buffer is not direct or the
+	 *                                  sample rate is not supported.
+	 */
+	public static long[] segment(ByteBuffer pcm, int sampleRate, VoiceSegmentationParams params) {
+		requireNonNull(params);
+
+		if (!pcm.isDirect()) {
+			throw new IllegalArgumentException("Audio buffer must be a direct buffer");
+		}
+
+		checkSampleRate(sampleRate);
+
+		return segmentDirect(pcm, pcm.position(), pcm.remaining() / 2, sampleRate,
+				params.threshold, params.minSpeechMillis, params.hangoverMillis);
+	}
+
+	static void checkSampleRate(int sampleRate) {
+		if (sampleRate <= 0 || sampleRate % 100 != 0) {
+			throw new IllegalArgumentException(
+					"Sample rate must be a positive multiple of 100 Hz: " + sampleRate);
+		}
+	}
+
 	/**
 	 * Releases native resources held by this object.
 	 */
@@ -63,4 +104,7 @@ public class VoiceActivityDetector extends DisposableNativeObject {
 	 */
 	private native void initialize();
 
+	private static native long[] segmentDirect(ByteBuffer pcm, int offset, int samples,
+			int sampleRate, float threshold, int minSpeechMillis, int hangoverMillis);
+
 }
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static java.util.Objects.requireNonNull;
+
+import dev.onvoid.webrtc.internal.DisposableNativeObject;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Streaming speech segmentation for mono 16-bit audio. Audio of any chunk size
+ * is analyzed natively in 10 ms frames, and the resulting speech starts and
+ * ends are reported to a {@link VoiceSegmentListener}. For audio that is
+ * available as a whole, use {@link VoiceActivityDetector#segment} instead.
+ */
+public class VoiceActivitySegmenter extends DisposableNativeObject {
+
+	private final VoiceSegmentListener listener;
+
+
+	/**
+	 * Creates a new {@code VoiceActivitySegmenter}.
+	 *
+	 * @param sampleRate The sample rate of the audio, a multiple of 100 Hz.
+	 * @param params     The segmentation parameters.
+	 * @param listener   The listener to receive the speech segment events.
+	 *
+	 * @throws IllegalArgumentException if the sample rate is not supported.
+	 */
+	public VoiceActivitySegmenter(int sampleRate, VoiceSegmentationParams params,
+			VoiceSegmentListener listener) {
+		requireNonNull(params);
+		requireNonNull(listener);
+
+		VoiceActivityDetector.checkSampleRate(sampleRate);
+
+		this.listener = listener;
+
+		initialize(sampleRate, params.threshold, params.minSpeechMillis,
+				params.hangoverMillis);
+	}
+
+	/**
+	 * Analyzes the remaining 16-bit samples in native byte order of the
+	 * direct buffer and reports speech events on the calling thread. Samples
+	 * that do not fill a 10 ms frame are kept for the next call. The buffer
+	 * position is not modified.
+	 *
+	 * @param pcm The direct buffer with mono audio samples.
+	 *
+	 * @throws IllegalArgumentException if the buffer is not direct.
+	 */
+	public void process(ByteBuffer pcm) {
+		if (!pcm.isDirect()) {
+			throw new IllegalArgumentException("Audio buffer must be a direct buffer");
+		}
+
+		dispatch(processDirect(pcm, pcm.position(), pcm.remaining() / 2));
+	}
+
+	/**
+	 * Ends an open speech segment, e.g. at the end of the stream.
+	 */
+	public void flush() {
+		dispatch(flushInternal());
+	}
+
+	/**
+	 * Advances by one 10 ms frame per given voice probability instead of
+	 * analyzing audio. Allows to test the segmentation rules with a known
+	 * sequence of probabilities.
+	 *
+	 * @param probabilities The voice probability of each frame.
+	 */
+	void processProbabilities(float[] probabilities) {
+		dispatch(processProbabilitiesInternal(requireNonNull(probabilities)));
+	}
+
+	@Override
+	public native void dispose();
+
+	private void dispatch(long[] events) {
+		if (events == null) {
+			return;
+		}
+
+		for (int i = 0; i < events.length; i += 2) {
+			if (events[i + 1] < 0) {
+				listener.onSpeechStart(events[i]);
+			}
+			else {
+				listener.onSpeechEnd(events[i], events[i + 1]);
+			}
+		}
+	}
+
+	private native void initialize(int sampleRate, float threshold, int minSpeechMillis, int hangoverMillis);
+
+	private native long[] processDirect(ByteBuffer pcm, int offset, int samples);
+
+	private native long[] processProbabilitiesInternal(float[] probabilities);
+
+	private native long[] flushInternal();
+
+}
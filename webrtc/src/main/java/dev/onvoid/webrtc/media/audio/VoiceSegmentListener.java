@@ -0,0 +1,40 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+/**
+ * Receives speech segment events from a {@link VoiceActivitySegmenter}. Offsets
+ * are given in samples since the first sample passed to the segmenter.
+ */
+public interface VoiceSegmentListener {
+
+	/**
+	 * Called once speech has lasted for the minimum speech duration.
+	 *
+	 * @param startOffset The offset at which the speech started.
+	 */
+	void onSpeechStart(long startOffset);
+
+	/**
+	 * Called when a speech segment has ended.
+	 *
+	 * @param startOffset The offset at which the speech started.
+	 * @param endOffset   The offset after the last speech sample.
+	 */
+	void onSpeechEnd(long startOffset, long endOffset);
+
+}
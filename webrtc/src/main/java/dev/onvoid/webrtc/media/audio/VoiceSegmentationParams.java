@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+/**
+ * Parameters that control how voice activity is turned into speech segments.
+ */
+public class VoiceSegmentationParams {
+
+	/** The voice probability at which a 10 ms frame counts as speech. */
+	public final float threshold;
+
+	/** The minimum duration of a speech segment in milliseconds. */
+	public final int minSpeechMillis;
+
+	/** The duration of non-speech in milliseconds that ends a segment. */
+	public final int hangoverMillis;
+
+
+	/**
+	 * Creates parameters with a threshold of 0.5, a minimum speech duration of
+	 * 250 ms and a hangover of 300 ms.
+	 */
+	public VoiceSegmentationParams() {
+		this(0.5f, 250, 300);
+	}
+
+	/**
+	 * Creates parameters for speech segmentation.
+	 *
+	 * @param threshold       The voice probability at which a frame counts as
+	 *                        speech, between 0.0 and 1.0.
+	 * @param minSpeechMillis The minimum duration of a speech segment.
+	 *                        Shorter speech is discarded.
+	 * @param hangoverMillis  The duration of non-speech that ends a segment.
+	 *                        Shorter pauses are bridged.
+	 *
+	 * @throws IllegalArgumentException if a parameter is out of range.
+	 */
+	public VoiceSegmentationParams(float threshold, int minSpeechMillis, int hangoverMillis) {
+		if (threshold < 0 || threshold > 1) {
+			throw new IllegalArgumentException("Threshold must be between 0 and 1");
+		}
+		if (minSpeechMillis < 0 || hangoverMillis < 0) {
+			throw new IllegalArgumentException("Durations must not be negative");
+		}
+
+		this.threshold = threshold;
+		this.minSpeechMillis = minSpeechMillis;
+		this.hangoverMillis = hangoverMillis;
+	}
+
+}
@@ -18,11 +18,13 @@ package dev.onvoid.webrtc;
 
 import static java.util.Objects.nonNull;
 import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 
 import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.Collections;
 import java.util.List;
 import java.util.concurrent.CountDownLatch;
@@ -106,26 +108,253 @@ class RTCDataChannelTests extends TestBase {
 	}
 
 
+	@Test
+	void pooledTextMessage() throws Exception {
+		ByteBuffer[] buffers = new ByteBuffer[4];
+
+		for (int i = 0; i < buffers.length; i++) {
+			buffers[i] = ByteBuffer.allocateDirect(1024);
+		}
+
+		RTCDataChannelBufferPool pool = new RTCDataChannelBufferPool(buffers);
+
+		DataPeerConnection caller = new DataPeerConnection(factory);
+		DataPeerConnection callee = new DataPeerConnection(factory, pool);
+
+		caller.setRemotePeerConnection(callee);
+		callee.setRemotePeerConnection(caller);
+
+		callee.setRemoteDescription(caller.createOffer());
+		caller.setRemoteDescription(callee.createAnswer());
+
+		caller.waitUntilConnected();
+		callee.waitUntilConnected();
+
+		Thread.sleep(500);
+
+		caller.sendTextMessage("Hello pool");
+		caller.sendTextMessage("Hello again");
+
+		Thread.sleep(500);
+
+		assertEquals(Arrays.asList("Hello pool", "Hello again"), callee.getReceivedTexts());
+		assertEquals(pool.getSize(), pool.getAvailable());
+		assertEquals(0, pool.getFallbackCount());
+
+		caller.close();
+		callee.close();
+		pool.dispose();
+	}
+
+	@Test
+	void queuedTextMessages() throws Exception {
+		RTCDataChannelExecutor executor = new RTCDataChannelExecutor(2);
+
+		DataPeerConnection caller = new DataPeerConnection(factory);
+		DataPeerConnection callee = new DataPeerConnection(factory, executor);
+
+		caller.setRemotePeerConnection(callee);
+		callee.setRemotePeerConnection(caller);
+
+		callee.setRemoteDescription(caller.createOffer());
+		caller.setRemoteDescription(callee.createAnswer());
+
+		caller.waitUntilConnected();
+		callee.waitUntilConnected();
+
+		Thread.sleep(500);
+
+		List<String> expected = new ArrayList<>();
+
+		for (int i = 0; i < 100; i++) {
+			String message = "Message " + i;
+
+			expected.add(message);
+			caller.sendTextMessage(message);
+		}
+
+		Thread.sleep(500);
+
+		assertEquals(expected, callee.getReceivedTexts());
+		assertEquals(0, callee.getRemoteDataChannel().getCallbackQueueDepth());
+
+		caller.close();
+		callee.close();
+		executor.dispose();
+	}
+
+	@Test
+	void compressedTextMessage() throws Exception {
+		RTCDataChannelInit init = new RTCDataChannelInit();
+		init.protocol = RTCDataChannel.COMPRESSION_PROTOCOL;
+
+		DataPeerConnection caller = new DataPeerConnection(factory, init);
+		DataPeerConnection callee = new DataPeerConnection(factory);
+
+		caller.setRemotePeerConnection(callee);
+		callee.setRemotePeerConnection(caller);
+
+		callee.setRemoteDescription(caller.createOffer());
+		caller.setRemoteDescription(callee.createAnswer());
+
+		caller.waitUntilConnected();
+		callee.waitUntilConnected();
+
+		Thread.sleep(500);
+
+		StringBuilder builder = new StringBuilder();
+
+		for (int i = 0; i < 200; i++) {
+			builder.append("{\"sensor\":\"temperature\",\"value\":21.5}");
+		}
+
+		String large = builder.toString();
+
+		caller.sendTextMessage("short");
+		caller.sendTextMessage(large);
+
+		Thread.sleep(500);
+
+		assertEquals(Arrays.asList("short", large), callee.getReceivedTexts());
+
+		RTCDataChannelCompressionStats sendStats = caller.getLocalDataChannel().getCompressionStats();
+		RTCDataChannelCompressionStats receiveStats = callee.getRemoteDataChannel().getCompressionStats();
+
+		assertEquals(2, sendStats.messagesSent);
+		assertEquals(1, sendStats.messagesCompressed);
+		assertTrue(sendStats.getSendRatio() > 1);
+		assertEquals(2, receiveStats.messagesReceived);
+		assertEquals(sendStats.bytesSent, receiveStats.bytesReceived);
+		assertEquals(sendStats.wireBytesSent, receiveStats.wireBytesReceived);
+
+		caller.close();
+		callee.close();
+	}
+
+	@Test
+	void snapshot() throws Exception {
+		DataPeerConnection caller = new DataPeerConnection(factory);
+		DataPeerConnection callee = new DataPeerConnection(factory);
+
+		caller.setRemotePeerConnection(callee);
+		callee.setRemotePeerConnection(caller);
+
+		callee.setRemoteDescription(caller.createOffer());
+		caller.setRemoteDescription(callee.createAnswer());
+
+		caller.waitUntilConnected();
+		callee.waitUntilConnected();
+
+		Thread.sleep(500);
+
+		caller.sendTextMessage("Hello");
+		caller.sendTextMessage("world");
+
+		Thread.sleep(500);
+
+		RTCDataChannel local = caller.getLocalDataChannel();
+		RTCDataChannel remote = callee.getRemoteDataChannel();
+
+		long[] out = new long[RTCDataChannel.SNAPSHOT_SIZE];
+		local.snapshot(out);
+
+		assertEquals(RTCDataChannelState.OPEN.ordinal(), out[RTCDataChannel.SNAPSHOT_STATE]);
+		assertEquals(2, out[RTCDataChannel.SNAPSHOT_MESSAGES_SENT]);
+		assertEquals(10, out[RTCDataChannel.SNAPSHOT_BYTES_SENT]);
+		assertEquals(local.getId(), out[RTCDataChannel.SNAPSHOT_ID]);
+
+		long[] all = new long[2 * RTCDataChannel.SNAPSHOT_SIZE];
+		RTCDataChannel.snapshotAll(new RTCDataChannel[] { local, remote }, all);
+
+		int offset = RTCDataChannel.SNAPSHOT_SIZE;
+
+		assertEquals(2, all[RTCDataChannel.SNAPSHOT_MESSAGES_SENT]);
+		assertEquals(RTCDataChannelState.OPEN.ordinal(), all[offset + RTCDataChannel.SNAPSHOT_STATE]);
+		assertEquals(2, all[offset + RTCDataChannel.SNAPSHOT_MESSAGES_RECEIVED]);
+		assertEquals(10, all[offset + RTCDataChannel.SNAPSHOT_BYTES_RECEIVED]);
+
+		assertThrows(IllegalArgumentException.class, () -> local.snapshot(new long[1]));
+		assertThrows(IllegalArgumentException.class,
+				() -> RTCDataChannel.snapshotAll(new RTCDataChannel[] { local, remote }, out));
+
+		caller.close();
+		callee.close();
+	}
+
+	@Test
+	void poolRejectsHeapBuffers() {
+		ByteBuffer[] buffers = { ByteBuffer.allocate(16) };
+
+		assertThrows(IllegalArgumentException.class, () -> new RTCDataChannelBufferPool(buffers));
+	}
+
+	@Test
+	void poolRejectsInvalidRelease() {
+		ByteBuffer[] buffers = { ByteBuffer.allocateDirect(16) };
+
+		RTCDataChannelBufferPool pool = new RTCDataChannelBufferPool(buffers);
+
+		// No message has been received, so no buffer is in use.
+		assertThrows(IllegalStateException.class, () -> pool.release(0));
+		assertThrows(IndexOutOfBoundsException.class, () -> pool.release(1));
+		assertEquals(1, pool.getAvailable());
+
+		pool.dispose();
+
+		assertThrows(IllegalStateException.class, () -> pool.getBuffer(0));
+		assertThrows(IllegalStateException.class, () -> pool.release(0));
+	}
+
 
 	private static class DataPeerConnection extends TestPeerConnection {
 
-		private final List<String> receivedTexts = new ArrayList<>();
+		private final List<String> receivedTexts = Collections.synchronizedList(new ArrayList<>());
 
 		private final RTCDataChannel localDataChannel;
 
+		private final RTCDataChannelBufferPool pool;
+
+		private final RTCDataChannelExecutor executor;
+
 		private RTCDataChannel remoteDataChannel;
 
 
 		DataPeerConnection(PeerConnectionFactory factory) {
+			this(factory, new RTCDataChannelInit(), null, null);
+		}
+
+		DataPeerConnection(PeerConnectionFactory factory, RTCDataChannelInit init) {
+			this(factory, init, null, null);
+		}
+
+		DataPeerConnection(PeerConnectionFactory factory, RTCDataChannelBufferPool pool) {
+			this(factory, new RTCDataChannelInit(), pool, null);
+		}
+
+		DataPeerConnection(PeerConnectionFactory factory, RTCDataChannelExecutor executor) {
+			this(factory, new RTCDataChannelInit(), null, executor);
+		}
+
+		private DataPeerConnection(PeerConnectionFactory factory, RTCDataChannelInit init,
+				RTCDataChannelBufferPool pool, RTCDataChannelExecutor executor) {
 			super(factory);
 
-			localDataChannel = getPeerConnection().createDataChannel("dc", new RTCDataChannelInit());
+			this.pool = pool;
+			this.executor = executor;
+
+			localDataChannel = getPeerConnection().createDataChannel("dc", init);
 		}
 
 		@Override
 		public void onDataChannel(RTCDataChannel dataChannel) {
 			remoteDataChannel = dataChannel;
-			remoteDataChannel.registerObserver(new RTCDataChannelObserver() {
+
+			if (nonNull(pool)) {
+				registerPoolObserver();
+				return;
+			}
+
+			RTCDataChannelObserver observer = new RTCDataChannelObserver() {
 
 				@Override
 				public void onBufferedAmountChange(long previousAmount) { }
@@ -142,13 +371,54 @@ class RTCDataChannelTests extends TestBase {
 						Assertions.fail(e);
 					}
 				}
-			});
+			};
+
+			if (nonNull(executor)) {
+				remoteDataChannel.registerObserver(observer, executor);
+			}
+			else {
+				remoteDataChannel.registerObserver(observer);
+			}
+		}
+
+		private void registerPoolObserver() {
+			remoteDataChannel.registerObserver(new RTCDataChannelPoolObserver() {
+
+				@Override
+				public void onPooledMessage(int index, int length, boolean binary) {
+					ByteBuffer data = pool.getBuffer(index).duplicate();
+					data.clear();
+					data.limit(length);
+
+					byte[] payload = new byte[length];
+					data.get(payload);
+
+					pool.release(index);
+
+					receivedTexts.add(new String(payload, StandardCharsets.UTF_8));
+				}
+
+				@Override
+				public void onBufferedAmountChange(long previousAmount) { }
+
+				@Override
+				public void onStateChange() { }
+
+				@Override
+				public void onMessage(RTCDataChannelBuffer buffer) {
+					decodeMessage(buffer);
+				}
+			}, pool);
 		}
 
 		RTCDataChannel getLocalDataChannel() {
 			return localDataChannel;
 		}
 
+		RTCDataChannel getRemoteDataChannel() {
+			return remoteDataChannel;
+		}
+
 		List<String> getReceivedTexts() {
 			return receivedTexts;
 		}
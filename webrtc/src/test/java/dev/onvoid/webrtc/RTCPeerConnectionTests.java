@@ -375,6 +375,54 @@ class RTCPeerConnectionTests extends TestBase {
 		assertFalse(statsReport.getStats().isEmpty());
 	}
 
+	@Test
+	void getStatsSnapshot() throws InterruptedException {
+		CountDownLatch latch = new CountDownLatch(1);
+		AtomicReference<RTCStatsSnapshot> snapshotRef = new AtomicReference<>();
+
+		peerConnection.getStatsSnapshot(snapshot -> {
+			snapshotRef.set(snapshot);
+
+			latch.countDown();
+		});
+
+		latch.await();
+
+		RTCStatsSnapshot snapshot = snapshotRef.get();
+
+		assertNotNull(snapshot);
+		assertTrue(snapshot.size() > 0);
+
+		int opened = RTCStatsSnapshot.getAttributeId("dataChannelsOpened");
+
+		assertEquals(opened, RTCStatsSnapshot.getAttributeId("dataChannelsOpened"));
+		assertEquals("dataChannelsOpened", RTCStatsSnapshot.getAttributeName(opened));
+		assertNull(RTCStatsSnapshot.getAttributeName(-1));
+
+		int index = -1;
+
+		for (int i = 0; i < snapshot.size(); i++) {
+			if (snapshot.getType(i) == RTCStatsType.PEER_CONNECTION) {
+				index = i;
+			}
+		}
+
+		assertTrue(index >= 0);
+		assertEquals(index, snapshot.indexOf(snapshot.getId(index)));
+		assertEquals(0, snapshot.getLong(index, opened, -1));
+
+		// Unknown names are not interned.
+		assertEquals(-1, RTCStatsSnapshot.getAttributeId("noSuchAttribute"));
+		assertEquals(-1, RTCStatsSnapshot.getAttributeId("noSuchAttribute"));
+
+		String statsId = peerConnection.getStatsId(snapshot.getId(index));
+
+		assertNotNull(statsId);
+		assertEquals(snapshot.getId(index), peerConnection.getStatsIdIndex(statsId));
+		assertEquals(-1, peerConnection.getStatsIdIndex("noSuchStatsId"));
+		assertNull(peerConnection.getStatsId(-1));
+	}
+
 	@Test
 	void statesWhenClosed() {
 		RTCConfiguration config = new RTCConfiguration();
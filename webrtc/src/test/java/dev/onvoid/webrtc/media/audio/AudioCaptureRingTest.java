@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import java.nio.ByteBuffer;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+@Execution(ExecutionMode.SAME_THREAD)
+class AudioCaptureRingTest {
+
+	private HeadlessAudioDeviceModule adm;
+
+
+	@BeforeEach
+	void init() {
+		adm = new HeadlessAudioDeviceModule();
+	}
+
+	@AfterEach
+	void dispose() {
+		adm.dispose();
+	}
+
+	@Test
+	void invalidCapacity() {
+		assertThrows(IllegalArgumentException.class, () -> new AudioCaptureRing(0));
+	}
+
+	@Test
+	void emptyRing() {
+		AudioCaptureRing ring = new AudioCaptureRing(1024);
+
+		assertEquals(1024, ring.getCapacity());
+		assertEquals(0, ring.available());
+		assertEquals(0, ring.read(ByteBuffer.allocate(16)));
+		assertThrows(Error.class, () -> ring.setReadPosition(1));
+
+		ring.dispose();
+	}
+
+	@Test
+	void captureAndDrain() throws Exception {
+		// 1 second of 48 kHz stereo audio.
+		AudioCaptureRing ring = new AudioCaptureRing(192000);
+
+		adm.setAudioCaptureRing(ring);
+		adm.initRecording();
+		adm.startRecording();
+
+		Thread.sleep(200);
+
+		adm.stopRecording();
+
+		int available = ring.available();
+
+		assertTrue(available > 0);
+		assertEquals(0, available % (ring.getChannels() * ring.getBytesPerSample()));
+		assertEquals(2, ring.getBytesPerSample());
+
+		ByteBuffer dst = ByteBuffer.allocateDirect(available);
+
+		assertEquals(available, ring.read(dst));
+		assertEquals(0, ring.available());
+		assertEquals(0, ring.getOverrunCount());
+
+		adm.dispose();
+		adm = new HeadlessAudioDeviceModule();
+
+		ring.dispose();
+	}
+
+	@Test
+	void overrun() throws Exception {
+		// Holds less than two 10 ms chunks.
+		AudioCaptureRing ring = new AudioCaptureRing(3000);
+
+		adm.setAudioCaptureRing(ring);
+		adm.initRecording();
+		adm.startRecording();
+
+		Thread.sleep(200);
+
+		adm.stopRecording();
+
+		assertTrue(ring.getOverrunCount() > 0);
+		assertTrue(ring.available() <= ring.getCapacity());
+
+		adm.dispose();
+		adm = new HeadlessAudioDeviceModule();
+
+		ring.dispose();
+	}
+
+}
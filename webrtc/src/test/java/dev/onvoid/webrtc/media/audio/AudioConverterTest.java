@@ -16,10 +16,15 @@
 
 package dev.onvoid.webrtc.media.audio;
 
+import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertThrows;
 
 import org.junit.jupiter.api.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
 class AudioConverterTest {
 
 	@Test
@@ -72,6 +77,79 @@ class AudioConverterTest {
 		});
 	}
 
+	@Test
+	void convertDirect() {
+		AudioConverter converter = new AudioConverter(44100, 2, 48000, 1);
+
+		ByteBuffer src = ByteBuffer.allocateDirect(441 * 2 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(480 * 2).order(ByteOrder.nativeOrder());
+
+		assertEquals(480, converter.convert(src, dst));
+		assertThrows(IllegalArgumentException.class, () -> {
+			converter.convert(ByteBuffer.allocate(441 * 2 * 2), dst);
+		});
+
+		converter.dispose();
+	}
+
+	@Test
+	void convertFloatUpMix() {
+		AudioConverter converter = new AudioConverter(48000, 1, 48000, 2);
+
+		FloatBuffer src = ByteBuffer.allocateDirect(480 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer dst = ByteBuffer.allocateDirect(960 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+		for (int i = 0; i < 480; i++) {
+			src.put(i, i / 480f);
+		}
+
+		assertEquals(960, converter.convert(src, dst));
+
+		// Mono is duplicated into both channels.
+		for (int i = 0; i < 480; i++) {
+			assertEquals(dst.get(2 * i), dst.get(2 * i + 1));
+		}
+		assertEquals(src.get(479), dst.get(958), 0.0001f);
+
+		converter.dispose();
+	}
+
+	@Test
+	void convertFloatResample() {
+		AudioConverter converter = new AudioConverter(48000, 2, 16000, 1);
+
+		FloatBuffer src = ByteBuffer.allocateDirect(960 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer dst = ByteBuffer.allocateDirect(160 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+		assertEquals(160, converter.convert(src, dst));
+		assertThrows(IllegalArgumentException.class, () -> {
+			converter.convert(src, FloatBuffer.allocate(160));
+		});
+
+		converter.dispose();
+	}
+
+	@Test
+	void convertFloatNonNativeOrder() {
+		AudioConverter converter = new AudioConverter(48000, 1, 48000, 1);
+
+		ByteOrder foreignOrder = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN
+				? ByteOrder.BIG_ENDIAN
+				: ByteOrder.LITTLE_ENDIAN;
+
+		FloatBuffer nativeBuffer = ByteBuffer.allocateDirect(480 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer foreignBuffer = ByteBuffer.allocateDirect(480 * 4).order(foreignOrder).asFloatBuffer();
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			converter.convert(foreignBuffer, nativeBuffer);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			converter.convert(nativeBuffer, foreignBuffer);
+		});
+
+		converter.dispose();
+	}
+
 	private static void convert(ProcessBuffer buffer) {
 		AudioConverter converter = new AudioConverter(buffer.sampleRateIn,
 				buffer.channelsIn, buffer.sampleRateOut, buffer.channelsOut);
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.file.Files;
+import java.util.Arrays;
+
+import org.junit.jupiter.api.Test;
+
+class AudioFileProcessorTest {
+
+	@Test
+	void invalidArguments() {
+		AudioProcessingConfig config = new AudioProcessingConfig();
+
+		assertThrows(NullPointerException.class, () -> new AudioFileProcessor(null));
+		assertThrows(IllegalArgumentException.class, () -> new AudioFileProcessor(config, 0));
+
+		AudioFileProcessor processor = new AudioFileProcessor(config, 2);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			processor.start(new String[2], new String[1]);
+		});
+		assertThrows(IndexOutOfBoundsException.class, () -> processor.getStatus(0));
+
+		processor.dispose();
+	}
+
+	@Test
+	void processFiles() throws IOException {
+		AudioProcessingConfig config = new AudioProcessingConfig();
+		config.noiseSuppression.enabled = true;
+		config.noiseSuppression.level = AudioProcessingConfig.NoiseSuppression.Level.HIGH;
+
+		final int fileCount = 8;
+		// 2.5 seconds, which ends with a partial block and a partial frame.
+		final int frames = 48000 * 5 / 2 + 17;
+
+		final int failedCount = 3;
+
+		String[] inputs = new String[fileCount + failedCount];
+		String[] outputs = new String[fileCount + failedCount];
+
+		for (int i = 0; i < fileCount; i++) {
+			File input = File.createTempFile("processor-in", ".wav");
+			File output = File.createTempFile("processor-out", ".wav");
+			input.deleteOnExit();
+			output.deleteOnExit();
+
+			writeWavFile(input, 48000, 2, frames);
+
+			inputs[i] = input.getAbsolutePath();
+			outputs[i] = output.getAbsolutePath();
+		}
+
+		// Missing and corrupt input files fail without affecting the others.
+		File missing = File.createTempFile("processor-missing", ".wav");
+		missing.delete();
+
+		File notWav = File.createTempFile("processor-corrupt", ".wav");
+		notWav.deleteOnExit();
+		Files.write(notWav.toPath(), "This is not a WAV file".getBytes());
+
+		File truncated = File.createTempFile("processor-truncated", ".wav");
+		truncated.deleteOnExit();
+		writeWavFile(truncated, 48000, 2, 0);
+		Files.write(truncated.toPath(), Arrays.copyOf(Files.readAllBytes(truncated.toPath()), 30));
+
+		inputs[fileCount] = missing.getAbsolutePath();
+		inputs[fileCount + 1] = notWav.getAbsolutePath();
+		inputs[fileCount + 2] = truncated.getAbsolutePath();
+
+		for (int i = fileCount; i < inputs.length; i++) {
+			File output = File.createTempFile("processor-out", ".wav");
+			output.deleteOnExit();
+
+			outputs[i] = output.getAbsolutePath();
+		}
+
+		AudioFileProcessor processor = new AudioFileProcessor(config, 4);
+		processor.start(inputs, outputs);
+		processor.await();
+
+		assertThrows(IllegalStateException.class, () -> processor.start(inputs, outputs));
+
+		float[] progress = new float[inputs.length];
+		processor.getProgress(progress);
+
+		for (int i = 0; i < fileCount; i++) {
+			assertEquals(AudioFileProcessor.Status.COMPLETED, processor.getStatus(i));
+			assertNull(processor.getError(i));
+			assertEquals(1, progress[i]);
+			assertEquals(new File(inputs[i]).length(), new File(outputs[i]).length());
+		}
+
+		for (int i = fileCount; i < inputs.length; i++) {
+			assertEquals(AudioFileProcessor.Status.FAILED, processor.getStatus(i));
+			assertNotNull(processor.getError(i));
+		}
+
+		processor.dispose();
+	}
+
+	private static void writeWavFile(File file, int sampleRate, int channels, int frames) throws IOException {
+		int dataSize = frames * channels * 2;
+
+		ByteBuffer buffer = ByteBuffer.allocate(44 + dataSize).order(ByteOrder.LITTLE_ENDIAN);
+		buffer.put("RIFF".getBytes()).putInt(36 + dataSize).put("WAVE".getBytes());
+		buffer.put("fmt ".getBytes()).putInt(16).putShort((short) 1).putShort((short) channels);
+		buffer.putInt(sampleRate).putInt(sampleRate * channels * 2);
+		buffer.putShort((short) (channels * 2)).putShort((short) 16);
+		buffer.put("data".getBytes()).putInt(dataSize);
+
+		for (int i = 0; i < frames * channels; i++) {
+			buffer.putShort((short) (Math.sin(i * 0.01) * 8000));
+		}
+
+		Files.write(file.toPath(), buffer.array());
+	}
+
+}
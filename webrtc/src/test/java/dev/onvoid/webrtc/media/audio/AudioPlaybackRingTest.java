@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+import java.nio.ByteBuffer;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+@Execution(ExecutionMode.SAME_THREAD)
+class AudioPlaybackRingTest {
+
+	private HeadlessAudioDeviceModule adm;
+
+
+	@BeforeEach
+	void init() {
+		adm = new HeadlessAudioDeviceModule();
+	}
+
+	@AfterEach
+	void dispose() {
+		adm.dispose();
+	}
+
+	@Test
+	void invalidParameters() {
+		assertThrows(IllegalArgumentException.class, () -> new AudioPlaybackRing(0, 0));
+		assertThrows(IllegalArgumentException.class, () -> new AudioPlaybackRing(1024, 2048));
+	}
+
+	@Test
+	void writeUntilFull() {
+		AudioPlaybackRing ring = new AudioPlaybackRing(1024, 512);
+
+		assertEquals(1024, ring.free());
+		assertEquals(1024, ring.write(ByteBuffer.allocate(1500)));
+		assertEquals(0, ring.free());
+		assertEquals(0, ring.write(ByteBuffer.allocate(16)));
+		assertThrows(Error.class, () -> ring.setWritePosition(2048));
+
+		ring.dispose();
+	}
+
+	@Test
+	void waitForPrefill() throws Exception {
+		AudioPlaybackRing ring = new AudioPlaybackRing(96000, 48000);
+
+		ring.write(ByteBuffer.allocateDirect(4800));
+
+		play(ring, 200);
+
+		assertEquals(0, ring.getReadPosition());
+		assertEquals(0, ring.getUnderrunCount());
+
+		ring.dispose();
+	}
+
+	@Test
+	void underrunAfterDrain() throws Exception {
+		AudioPlaybackRing ring = new AudioPlaybackRing(96000, 4800);
+
+		ring.write(ByteBuffer.allocateDirect(4800));
+
+		play(ring, 300);
+
+		assertEquals(4800, ring.getReadPosition());
+		assertTrue(ring.getUnderrunCount() > 0);
+		assertTrue(ring.getSampleRate() > 0);
+
+		ring.dispose();
+	}
+
+	@Test
+	void playWithCaptureRing() throws Exception {
+		AudioPlaybackRing ring = new AudioPlaybackRing(96000, 4800);
+		AudioCaptureRing captureRing = new AudioCaptureRing(192000);
+
+		ring.write(ByteBuffer.allocateDirect(4800));
+
+		// Both rings share the audio callback of the module, so the audio
+		// pulled from the playback ring is delivered to the capture ring.
+		adm.setAudioCaptureRing(captureRing);
+		play(ring, 300);
+
+		assertEquals(4800, ring.getReadPosition());
+		assertTrue(captureRing.getWritePosition() > 0);
+
+		ring.dispose();
+		captureRing.dispose();
+	}
+
+	/**
+	 * The headless module pulls its simulated microphone input from the
+	 * registered playback source, which drives the ring without a device.
+	 */
+	private void play(AudioPlaybackRing ring, long millis) throws Exception {
+		adm.setAudioPlaybackRing(ring);
+		adm.initRecording();
+		adm.startRecording();
+
+		Thread.sleep(millis);
+
+		adm.stopRecording();
+		adm.dispose();
+		adm = new HeadlessAudioDeviceModule();
+	}
+
+}
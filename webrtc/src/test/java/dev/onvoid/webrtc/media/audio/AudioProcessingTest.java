@@ -18,6 +18,7 @@ package dev.onvoid.webrtc.media.audio;
 
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertThrows;
 import static org.junit.jupiter.api.Assertions.assertTrue;
 import static org.junit.jupiter.api.Assertions.assertFalse;
 
@@ -27,6 +28,11 @@ import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.Arrays;
+
 class AudioProcessingTest {
 
 	private AudioProcessing audioProcessing;
@@ -224,6 +230,30 @@ class AudioProcessingTest {
 		assertNotNull(audioProcessing.getStatistics());
 	}
 
+	@Test
+	void getTimingStats() {
+		AudioProcessingConfig config = new AudioProcessingConfig();
+		config.noiseSuppression.enabled = true;
+
+		audioProcessing.applyConfig(config);
+
+		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 1);
+
+		for (int i = 0; i < 10; i++) {
+			process(audioProcessing, buffer);
+		}
+
+		AudioProcessingStats stats = audioProcessing.getStatistics();
+
+		assertEquals(10, stats.captureFrames);
+		assertEquals(0, stats.renderFrames);
+		assertEquals(10, Arrays.stream(stats.captureTimeHistogram).sum());
+		assertTrue(stats.captureTimeMaxUs >= stats.captureTimeMeanUs);
+		assertTrue(stats.captureFramesPerSecond > 0);
+		assertTrue(stats.noiseSuppressionEnabled);
+		assertFalse(stats.echoCancellerEnabled);
+	}
+
 	@Test
 	void processByteStream() {
 		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 1);
@@ -245,6 +275,52 @@ class AudioProcessingTest {
 		assertEquals(0, process(audioProcessing, buffer));
 	}
 
+	@Test
+	void processByteStreamChannelMapping() {
+		assertEquals(0, process(audioProcessing, new ProcessBuffer(48000, 48000, 2, 4)));
+		assertEquals(0, process(audioProcessing, new ProcessBuffer(48000, 48000, 6, 2)));
+		assertEquals(0, processReverse(audioProcessing, new ProcessBuffer(48000, 44100, 2, 6)));
+	}
+
+	@Test
+	void processByteStreamTooManyChannels() {
+		// Remixing supports up to 8 channels.
+		assertThrows(IllegalArgumentException.class, () -> {
+			process(audioProcessing, new ProcessBuffer(48000, 48000, 10, 2));
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			processReverse(audioProcessing, new ProcessBuffer(48000, 48000, 2, 10));
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 12),
+					new AudioProcessingStreamConfig(48000, 2));
+		});
+	}
+
+	@Test
+	void processByteStreamUpMixGainFree() {
+		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 4);
+
+		for (int i = 0; i < buffer.nSamplesIn; i++) {
+			short sample = (short) (i * 40);
+
+			buffer.src[2 * i] = (byte) (sample & 0xFF);
+			buffer.src[2 * i + 1] = (byte) (sample >> 8);
+		}
+
+		assertEquals(0, process(audioProcessing, buffer));
+
+		// Mono is duplicated into all channels.
+		for (int i = 0; i < buffer.nSamplesOut; i++) {
+			for (int c = 1; c < buffer.channelsOut; c++) {
+				int frame = i * buffer.channelsOut * 2;
+
+				assertEquals(buffer.dst[frame], buffer.dst[frame + 2 * c]);
+				assertEquals(buffer.dst[frame + 1], buffer.dst[frame + 2 * c + 1]);
+			}
+		}
+	}
+
 	@Test
 	void processReverseStream() {
 		ProcessBuffer buffer = new ProcessBuffer(48000, 48000, 1, 1);
@@ -252,6 +328,111 @@ class AudioProcessingTest {
 		assertEquals(0, processReverse(audioProcessing, buffer));
 	}
 
+	@Test
+	void processDirectBatch() {
+		int frames = 50;
+
+		audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 1),
+				new AudioProcessingStreamConfig(48000, 1));
+
+		ByteBuffer src = ByteBuffer.allocateDirect(frames * 480 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(frames * 480 * 2).order(ByteOrder.nativeOrder());
+
+		assertEquals(0, audioProcessing.processStream(src, dst, frames));
+		// In-place processing.
+		assertEquals(0, audioProcessing.processStream(src, src, frames));
+		assertEquals(0, src.position());
+	}
+
+	@Test
+	void processDirectBatchUpMix() {
+		int frames = 10;
+
+		audioProcessing.setReverseStreamConfig(new AudioProcessingStreamConfig(48000, 1),
+				new AudioProcessingStreamConfig(44100, 2));
+
+		ByteBuffer src = ByteBuffer.allocateDirect(frames * 480 * 2);
+		ByteBuffer dst = ByteBuffer.allocateDirect(frames * 441 * 2 * 2);
+
+		assertEquals(0, audioProcessing.processReverseStream(src, dst, frames));
+	}
+
+	@Test
+	void processFloat() {
+		int frames = 10;
+
+		audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 2),
+				new AudioProcessingStreamConfig(48000, 2));
+
+		FloatBuffer src = ByteBuffer.allocateDirect(frames * 960 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer dst = ByteBuffer.allocateDirect(frames * 960 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+		for (int i = 0; i < src.capacity(); i++) {
+			src.put(i, 0.25f);
+		}
+
+		assertEquals(0, audioProcessing.processStream(src, dst, frames));
+		assertEquals(0, audioProcessing.processStreamPlanar(src, dst, frames));
+		// Without effects enabled the audio passes through.
+		assertEquals(0.25f, dst.get(dst.capacity() - 1), 0.001f);
+	}
+
+	@Test
+	void processFloatReverseDownMix() {
+		int frames = 10;
+
+		audioProcessing.setReverseStreamConfig(new AudioProcessingStreamConfig(48000, 2),
+				new AudioProcessingStreamConfig(16000, 1));
+
+		FloatBuffer src = ByteBuffer.allocateDirect(frames * 960 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer dst = ByteBuffer.allocateDirect(frames * 160 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+		assertEquals(0, audioProcessing.processReverseStream(src, dst, frames));
+		assertEquals(0, audioProcessing.processReverseStreamPlanar(src, dst, frames));
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processReverseStream(src, dst, frames + 1));
+	}
+
+	@Test
+	void processFloatNonNativeOrder() {
+		ByteOrder foreignOrder = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN
+				? ByteOrder.BIG_ENDIAN
+				: ByteOrder.LITTLE_ENDIAN;
+
+		AudioProcessingStreamConfig config = new AudioProcessingStreamConfig(48000, 1);
+
+		audioProcessing.setStreamConfig(config, config);
+		audioProcessing.setReverseStreamConfig(config, config);
+
+		FloatBuffer nativeBuffer = ByteBuffer.allocateDirect(480 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer foreignBuffer = ByteBuffer.allocateDirect(480 * 4).order(foreignOrder).asFloatBuffer();
+
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processStream(foreignBuffer, nativeBuffer, 1));
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processStreamPlanar(nativeBuffer, foreignBuffer, 1));
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processReverseStream(foreignBuffer, nativeBuffer, 1));
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processReverseStreamPlanar(nativeBuffer, foreignBuffer, 1));
+	}
+
+	@Test
+	void processDirectInvalid() {
+		ByteBuffer src = ByteBuffer.allocateDirect(480 * 2);
+
+		assertThrows(IllegalStateException.class,
+				() -> audioProcessing.processStream(src, src, 1));
+
+		audioProcessing.setStreamConfig(new AudioProcessingStreamConfig(48000, 1),
+				new AudioProcessingStreamConfig(48000, 1));
+
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processStream(src, src, 2));
+		assertThrows(IllegalArgumentException.class,
+				() -> audioProcessing.processStream(ByteBuffer.allocate(480 * 2), src, 1));
+	}
+
 	@Test
 	void streamDelay() {
 		int delay = 70;
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import dev.onvoid.webrtc.TestBase;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+import java.io.File;
+
+class AudioTrackRecorderTest extends TestBase {
+
+	private CustomAudioSource audioSource;
+
+	private AudioTrack audioTrack;
+
+
+	@BeforeEach
+	void init() {
+		audioSource = new CustomAudioSource();
+		audioTrack = factory.createAudioTrack("audioTrack", audioSource);
+	}
+
+	@AfterEach
+	void dispose() {
+		audioTrack.dispose();
+	}
+
+	@Test
+	void invalidArguments() {
+		assertThrows(NullPointerException.class, () -> new AudioTrackRecorder(null, AudioTrackRecorder.FileFormat.WAV));
+		assertThrows(IllegalArgumentException.class, () -> new AudioTrackRecorder("track.wav", AudioTrackRecorder.FileFormat.WAV, 10));
+		assertThrows(NullPointerException.class, () -> audioTrack.addRecorder(null));
+	}
+
+	@Test
+	void recordWavFile() throws Exception {
+		File file = File.createTempFile("track-recorder", ".wav");
+		file.deleteOnExit();
+
+		AudioTrackRecorder recorder = new AudioTrackRecorder(file.getAbsolutePath(), AudioTrackRecorder.FileFormat.WAV);
+
+		audioTrack.addRecorder(recorder);
+
+		byte[] chunk = new byte[480 * 2 * 2];
+
+		for (int i = 0; i < 50; i++) {
+			audioSource.pushAudio(chunk, 16, 48000, 2, 480);
+		}
+
+		audioTrack.removeRecorder(recorder);
+		recorder.dispose();
+
+		// 44 byte WAV header and 500 ms of 48 kHz stereo 16-bit audio.
+		assertEquals(44 + 50 * chunk.length, file.length());
+	}
+
+	@Test
+	void recordRawFile() throws Exception {
+		File file = File.createTempFile("track-recorder", ".pcm");
+		file.deleteOnExit();
+
+		AudioTrackRecorder recorder = new AudioTrackRecorder(file.getAbsolutePath(), AudioTrackRecorder.FileFormat.RAW);
+
+		audioTrack.addRecorder(recorder);
+
+		byte[] chunk = new byte[160 * 2];
+
+		for (int i = 0; i < 10; i++) {
+			audioSource.pushAudio(chunk, 16, 16000, 1, 160);
+		}
+
+		// A chunk with a different format is dropped.
+		audioSource.pushAudio(new byte[480 * 2], 16, 48000, 1, 480);
+
+		audioTrack.removeRecorder(recorder);
+
+		assertEquals(1, recorder.getDroppedCount());
+
+		recorder.dispose();
+
+		assertEquals(10 * chunk.length, file.length());
+	}
+
+	@Test
+	void manyRecorders() throws Exception {
+		AudioTrackRecorder[] recorders = new AudioTrackRecorder[100];
+		File[] files = new File[recorders.length];
+
+		for (int i = 0; i < recorders.length; i++) {
+			files[i] = File.createTempFile("track-recorder", ".wav");
+			files[i].deleteOnExit();
+
+			recorders[i] = new AudioTrackRecorder(files[i].getAbsolutePath(), AudioTrackRecorder.FileFormat.WAV);
+
+			audioTrack.addRecorder(recorders[i]);
+		}
+
+		byte[] chunk = new byte[480 * 2];
+
+		for (int i = 0; i < 20; i++) {
+			audioSource.pushAudio(chunk, 16, 48000, 1, 480);
+			Thread.sleep(10);
+		}
+
+		for (int i = 0; i < recorders.length; i++) {
+			audioTrack.removeRecorder(recorders[i]);
+
+			assertEquals(0, recorders[i].getDroppedCount());
+
+			recorders[i].dispose();
+
+			assertEquals(44 + 20 * chunk.length, files[i].length());
+		}
+	}
+
+}
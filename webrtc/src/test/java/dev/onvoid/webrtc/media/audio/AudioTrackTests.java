@@ -24,6 +24,8 @@ import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
 
+import java.util.concurrent.atomic.AtomicInteger;
+
 class AudioTrackTests extends TestBase {
 
 	private AudioTrack audioTrack;
@@ -71,4 +73,89 @@ class AudioTrackTests extends TestBase {
 		audioTrack.removeSink(sink);
 	}
 
+	@Test
+	void addNullDirectSink() {
+		assertThrows(NullPointerException.class, () -> audioTrack.addDirectSink(null));
+	}
+
+	@Test
+	void addRemoveDirectSink() {
+		CustomAudioSource customSource = new CustomAudioSource();
+		AudioTrack customTrack = factory.createAudioTrack("customTrack", customSource);
+		AtomicInteger receivedFrames = new AtomicInteger(0);
+		AtomicInteger receivedBytes = new AtomicInteger(0);
+
+		AudioTrackDirectSink sink = (data, bitsPerSample, sampleRate, channels, frames) -> {
+			receivedFrames.addAndGet(frames);
+			receivedBytes.set(data.remaining());
+		};
+
+		// 10 ms of 48kHz mono.
+		byte[] chunk = new byte[480 * 2];
+
+		customTrack.addDirectSink(sink);
+		customSource.pushAudio(chunk, 16, 48000, 1, 480);
+
+		assertEquals(480, receivedFrames.get());
+		assertEquals(chunk.length, receivedBytes.get());
+
+		customTrack.removeDirectSink(sink);
+		customSource.pushAudio(chunk, 16, 48000, 1, 480);
+
+		assertEquals(480, receivedFrames.get());
+
+		customTrack.dispose();
+		customSource.dispose();
+	}
+
+	@Test
+	void pollLevels() {
+		CustomAudioSource customSource = new CustomAudioSource();
+		AudioTrack customTrack = factory.createAudioTrack("customTrack", customSource);
+
+		customTrack.enableLevelMeter();
+
+		// A full scale square wave, 10 ms of 48kHz mono.
+		byte[] chunk = new byte[480 * 2];
+
+		for (int i = 0; i < 480; i++) {
+			short sample = (i / 24) % 2 == 0 ? Short.MAX_VALUE : -Short.MAX_VALUE;
+
+			chunk[2 * i] = (byte) (sample & 0xFF);
+			chunk[2 * i + 1] = (byte) (sample >> 8);
+		}
+
+		for (int i = 0; i < 50; i++) {
+			customSource.pushAudio(chunk, 16, 48000, 1, 480);
+		}
+
+		AudioTrack[] tracks = { customTrack, audioTrack, null };
+		float[] levels = new float[tracks.length * AudioTrack.LEVEL_VALUES];
+
+		AudioTrack.pollLevels(tracks, levels);
+
+		assertEquals(1, levels[0], 0.01f);
+		assertEquals(1, levels[1], 0.01f);
+		assertTrue(levels[2] > -3 && levels[2] <= 0);
+
+		// Tracks without a meter are reported as silence.
+		assertEquals(0, levels[3]);
+		assertEquals(0, levels[4]);
+		assertEquals(-100, levels[5]);
+		assertEquals(-100, levels[8]);
+
+		// The peak is reset by each poll.
+		AudioTrack.pollLevels(tracks, levels);
+
+		assertEquals(0, levels[1]);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			AudioTrack.pollLevels(tracks, new float[3]);
+		});
+
+		customTrack.disableLevelMeter();
+		customTrack.dispose();
+		customSource.dispose();
+	}
+
 }
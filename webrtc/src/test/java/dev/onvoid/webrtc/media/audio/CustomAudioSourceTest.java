@@ -26,6 +26,10 @@ import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicInteger;
 
@@ -91,6 +95,294 @@ class CustomAudioSourceTest extends TestBase {
         testAudioFormat(16, 48000, 2, 480); // 16-bit, 48kHz, stereo, 10ms
     }
     
+    @Test
+    void pushDirectAudioData() {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedFrames = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> receivedFrames.set(frames);
+
+        audioTrack.addSink(testSink);
+
+        // 10ms of 48kHz stereo 16-bit audio.
+        ByteBuffer audioData = ByteBuffer.allocateDirect(480 * 2 * 2);
+
+        customAudioSource.pushAudio(audioData, 16, 48000, 2, 480);
+
+        assertEquals(480, receivedFrames.get());
+        assertEquals(0, audioData.position());
+
+        assertThrows(IllegalArgumentException.class, () -> {
+            customAudioSource.pushAudio(ByteBuffer.allocate(480 * 2 * 2), 16, 48000, 2, 480);
+        });
+        assertThrows(IllegalArgumentException.class, () -> {
+            customAudioSource.pushAudio(ByteBuffer.allocateDirect(100), 16, 48000, 2, 480);
+        });
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushFloatAudioData() {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedBitsPerSample = new AtomicInteger(0);
+        AtomicInteger receivedFrames = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> {
+            receivedBitsPerSample.set(bits);
+            receivedFrames.set(frames);
+        };
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.pushAudio(new float[480 * 2], 48000, 2, 480);
+
+        assertEquals(16, receivedBitsPerSample.get());
+        assertEquals(480, receivedFrames.get());
+
+        FloatBuffer audioData = ByteBuffer.allocateDirect(480 * 2 * 4)
+                .order(ByteOrder.nativeOrder())
+                .asFloatBuffer();
+
+        receivedFrames.set(0);
+        customAudioSource.pushAudio(audioData, 48000, 2, 480);
+
+        assertEquals(480, receivedFrames.get());
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushAudioWithTargetFormat() {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedSampleRate = new AtomicInteger(0);
+        AtomicInteger receivedChannels = new AtomicInteger(0);
+        AtomicInteger receivedFrames = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> {
+            receivedSampleRate.set(rate);
+            receivedChannels.set(chans);
+            receivedFrames.set(frames);
+        };
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.setTargetFormat(48000, 2);
+
+        // 10ms of 44.1kHz mono float audio.
+        customAudioSource.pushAudio(new float[441], 44100, 1, 441);
+
+        assertEquals(48000, receivedSampleRate.get());
+        assertEquals(2, receivedChannels.get());
+        assertEquals(480, receivedFrames.get());
+
+        // 10ms of 16kHz stereo 16-bit audio.
+        customAudioSource.pushAudio(new byte[160 * 2 * 2], 16, 16000, 2, 160);
+
+        assertEquals(48000, receivedSampleRate.get());
+        assertEquals(2, receivedChannels.get());
+        assertEquals(480, receivedFrames.get());
+
+        customAudioSource.setTargetFormat(0, 0);
+        customAudioSource.pushAudio(new float[441], 44100, 1, 441);
+
+        assertEquals(44100, receivedSampleRate.get());
+        assertEquals(1, receivedChannels.get());
+
+        assertThrows(IllegalArgumentException.class, () -> {
+            customAudioSource.setTargetFormat(-1, 2);
+        });
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushAudioWithTargetFormatIsContinuous() {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        int chunks = 20;
+        short[] left = new short[chunks * 480];
+        AtomicInteger written = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> {
+            ByteBuffer buffer = ByteBuffer.wrap(data).order(ByteOrder.nativeOrder());
+
+            for (int i = 0; i < frames; i++) {
+                left[written.getAndIncrement()] = buffer.getShort(i * chans * 2);
+            }
+        };
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.setTargetFormat(48000, 2);
+
+        // A continuous 440 Hz sine, pushed in 10ms chunks of 44.1kHz mono.
+        float[] chunk = new float[441];
+
+        for (int n = 0; n < chunks; n++) {
+            for (int i = 0; i < chunk.length; i++) {
+                chunk[i] = (float) (0.5 * Math.sin(2 * Math.PI * 440 * (n * 441 + i) / 44100));
+            }
+
+            customAudioSource.pushAudio(chunk, 44100, 1, 441);
+        }
+
+        assertEquals(left.length, written.get());
+
+        // A sine of this level changes by less than 1000 per sample at 48kHz.
+        // A resampler that is rebuilt for every chunk restarts from silence at
+        // each chunk boundary. The first chunk contains the resampler delay.
+        for (int i = 481; i < left.length; i++) {
+            assertTrue(Math.abs(left[i] - left[i - 1]) < 1500, "Discontinuity at sample " + i);
+        }
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushOddChunksWithTargetFormat() {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedSampleRate = new AtomicInteger(0);
+        AtomicInteger receivedFrames = new AtomicInteger(0);
+        AtomicInteger deliveries = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> {
+            receivedSampleRate.set(rate);
+            receivedFrames.addAndGet(frames);
+            deliveries.incrementAndGet();
+        };
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.setTargetFormat(48000, 2);
+
+        // Decoder sized chunks of 1024 frames at 44.1kHz, without pacing.
+        for (int n = 0; n < 10; n++) {
+            customAudioSource.pushAudio(new byte[1024 * 2], 16, 44100, 1, 1024);
+        }
+
+        // 10240 frames are 23 whole chunks of 441 frames.
+        assertEquals(48000, receivedSampleRate.get());
+        assertEquals(23, deliveries.get());
+        assertEquals(23 * 480, receivedFrames.get());
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushAudioWithPacing() throws Exception {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedSampleRate = new AtomicInteger(0);
+        AtomicInteger receivedFrames = new AtomicInteger(0);
+        AtomicInteger frameCount = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> {
+            receivedSampleRate.set(rate);
+            receivedFrames.set(frames);
+            frameCount.incrementAndGet();
+        };
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.startPacing(48000, 2, 200);
+
+        // Push 100ms of 44.1kHz stereo audio in decoder-sized chunks.
+        for (int i = 0; i < 5; i++) {
+            customAudioSource.pushAudio(new float[1024 * 2], 44100, 2, 1024);
+        }
+
+        assertTrue(customAudioSource.getPacingBufferedFrames() > 0);
+
+        // Wait longer than the pushed audio lasts to drain the buffer.
+        Thread.sleep(200);
+
+        assertTrue(customAudioSource.getPacingUnderrunCount() > 0);
+        assertEquals(0, customAudioSource.getPacingOverrunCount());
+
+        customAudioSource.stopPacing();
+
+        assertTrue(frameCount.get() > 0, "No paced audio was received");
+        assertEquals(48000, receivedSampleRate.get());
+        assertEquals(480, receivedFrames.get());
+        assertEquals(0, customAudioSource.getPacingBufferedFrames());
+
+        assertThrows(IllegalArgumentException.class, () -> {
+            customAudioSource.startPacing(44101, 2, 200);
+        });
+        assertThrows(IllegalArgumentException.class, () -> {
+            customAudioSource.startPacing(48000, 2, 5);
+        });
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void pushOtherSampleFormatsWithPacing() throws Exception {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger receivedBits = new AtomicInteger(0);
+        AudioTrackSink testSink = (data, bits, rate, chans, frames) -> receivedBits.set(bits);
+
+        audioTrack.addSink(testSink);
+
+        customAudioSource.startPacing(48000, 1, 200);
+
+        // 24-bit and 8-bit audio goes through the pacer as 16-bit audio.
+        customAudioSource.pushAudio(new byte[1024 * 3], 24, 48000, 1, 1024);
+        customAudioSource.pushAudio(new byte[1024], 8, 48000, 1, 1024);
+
+        assertTrue(customAudioSource.getPacingBufferedFrames() > 0);
+
+        Thread.sleep(100);
+
+        customAudioSource.stopPacing();
+
+        assertEquals(16, receivedBits.get());
+
+        audioTrack.removeSink(testSink);
+        audioTrack.dispose();
+    }
+
+    @Test
+    void addRemoveSinksWhilePushing() throws Exception {
+        AudioTrack audioTrack = factory.createAudioTrack("audioTrack", customAudioSource);
+        AtomicInteger permanentFrames = new AtomicInteger(0);
+        AudioTrackSink permanentSink = (data, bits, rate, chans, frames) -> permanentFrames.incrementAndGet();
+
+        audioTrack.addSink(permanentSink);
+
+        AtomicBoolean pushing = new AtomicBoolean(true);
+        AtomicInteger pushCount = new AtomicInteger(0);
+        CountDownLatch pusherStarted = new CountDownLatch(1);
+
+        Thread pusher = new Thread(() -> {
+            byte[] audioData = new byte[480 * 2 * 2];
+
+            pusherStarted.countDown();
+
+            while (pushing.get()) {
+                customAudioSource.pushAudio(audioData, 16, 48000, 2, 480);
+                pushCount.incrementAndGet();
+            }
+        });
+        pusher.start();
+        pusherStarted.await();
+
+        // Churn sinks while audio is being pushed.
+        for (int i = 0; i < 2000; i++) {
+            AudioTrackSink sink = (data, bits, rate, chans, frames) -> { };
+
+            audioTrack.addSink(sink);
+            audioTrack.removeSink(sink);
+        }
+
+        pushing.set(false);
+        pusher.join();
+
+        assertEquals(pushCount.get(), permanentFrames.get());
+
+        audioTrack.removeSink(permanentSink);
+        audioTrack.dispose();
+    }
+
     @Test
     void constructWithSyncClock() {
         // Create a SyncClock.
@@ -18,7 +18,9 @@ package dev.onvoid.webrtc.media.audio;
 
 import static org.junit.jupiter.api.Assertions.*;
 
+import java.io.File;
 import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
 
 import dev.onvoid.webrtc.PeerConnectionFactory;
 
@@ -103,6 +105,106 @@ public class HeadlessADMTest {
         assertThrows(Error.class, () -> adm.startRecording());
     }
 
+    @Test
+    void playoutTap_receivesMixedAudio() throws Exception {
+        AudioCaptureRing ring = new AudioCaptureRing(48000);
+
+        adm.initPlayout();
+        adm.setPlayoutTap(ring);
+        adm.startPlayout();
+
+        Thread.sleep(100);
+
+        adm.stopPlayout();
+        adm.removePlayoutTap();
+
+        assertTrue(ring.available() > 0, "Playout tap should receive audio");
+        assertEquals(48000, ring.getSampleRate());
+        assertEquals(2, ring.getBytesPerSample());
+
+        ring.dispose();
+    }
+
+    @Test
+    void playoutTapFile_writesWavFile() throws Exception {
+        File file = File.createTempFile("playout-tap", ".wav");
+        file.deleteOnExit();
+
+        adm.initPlayout();
+        adm.setPlayoutTapFile(file.getAbsolutePath());
+        adm.startPlayout();
+
+        Thread.sleep(100);
+
+        adm.stopPlayout();
+        adm.removePlayoutTap();
+
+        // More than the 44 byte WAV header.
+        assertTrue(file.length() > 44, "Playout tap file should contain audio");
+    }
+
+    @Test
+    void sharedClock_drivesManyModules() throws Exception {
+        HeadlessAudioDeviceModule[] modules = new HeadlessAudioDeviceModule[20];
+
+        for (int i = 0; i < modules.length; i++) {
+            modules[i] = new HeadlessAudioDeviceModule(HeadlessAudioClock.SHARED);
+            modules[i].initPlayout();
+            modules[i].initRecording();
+            modules[i].startPlayout();
+            modules[i].startRecording();
+        }
+
+        Thread.sleep(200);
+
+        for (HeadlessAudioDeviceModule module : modules) {
+            module.stopPlayout();
+            module.stopRecording();
+
+            assertTrue(module.getTickCount() > 0, "Shared clock should tick every module");
+            assertTrue(module.getMaxTickLateness() >= module.getAverageTickLateness());
+
+            module.dispose();
+        }
+    }
+
+    @Test
+    void manualClock_advancesInLockstep() {
+        HeadlessAudioDeviceModule module = new HeadlessAudioDeviceModule(HeadlessAudioClock.MANUAL);
+        AtomicInteger captured = new AtomicInteger();
+        AudioCaptureRing playout = new AudioCaptureRing(48000 * 2 * 2);
+
+        module.setAudioSource((audioSamples, nSamples, nBytesPerSample, nChannels, samplesPerSec) -> {
+            captured.incrementAndGet();
+            return nSamples;
+        });
+        module.setPlayoutTap(playout);
+
+        // Nothing to tick before playout or recording has been started.
+        assertEquals(0, module.advance(10));
+
+        module.initRecording();
+        module.startRecording();
+
+        // Half a second of audio, processed without waiting.
+        assertEquals(50, module.advance(50));
+        assertEquals(50, captured.get());
+
+        module.initPlayout();
+        module.startPlayout();
+
+        assertEquals(50, module.advance(50));
+        assertEquals(100, module.getTickCount());
+        assertEquals(50 * 480 * 2, playout.available());
+
+        module.stopPlayout();
+        module.stopRecording();
+        module.dispose();
+        playout.dispose();
+
+        assertThrows(IllegalStateException.class, () -> adm.advance(1));
+    }
+
 	@Test
 	void initPeerConnectionFactory() {
 		PeerConnectionFactory factory = new PeerConnectionFactory(adm);
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+import org.junit.jupiter.api.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+
+class StreamingAudioResamplerTest {
+
+	@Test
+	void invalidArguments() {
+		assertThrows(IllegalArgumentException.class, () -> {
+			new StreamingAudioResampler(0, 48000, 1);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			new StreamingAudioResampler(44100, 48000, 0);
+		});
+	}
+
+	@Test
+	void resampleDecoderChunks() {
+		StreamingAudioResampler resampler = new StreamingAudioResampler(44100, 48000, 2);
+
+		ByteBuffer src = ByteBuffer.allocateDirect(1024 * 2 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(2048 * 2 * 2).order(ByteOrder.nativeOrder());
+
+		int written = 0;
+
+		for (int i = 0; i < 100; i++) {
+			src.clear();
+			dst.clear();
+
+			written += resampler.resample(src, dst);
+
+			assertEquals(0, src.remaining());
+		}
+
+		// 102400 input frames make 232 blocks of 441 frames, 480 frames each.
+		assertEquals(232 * 480, written);
+		assertEquals(0, resampler.getAvailableFrames());
+
+		resampler.dispose();
+	}
+
+	@Test
+	void keepPendingOutput() {
+		StreamingAudioResampler resampler = new StreamingAudioResampler(16000, 48000, 1);
+
+		ByteBuffer src = ByteBuffer.allocateDirect(160 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer dst = ByteBuffer.allocateDirect(100 * 2).order(ByteOrder.nativeOrder());
+
+		assertEquals(100, resampler.resample(src, dst));
+		assertEquals(380, resampler.getAvailableFrames());
+		assertEquals(0, dst.remaining());
+
+		// Fetch the pending frames with an empty input buffer.
+		src.limit(0);
+		dst.clear();
+
+		assertEquals(100, resampler.resample(src, dst));
+		assertEquals(280, resampler.getAvailableFrames());
+
+		resampler.reset();
+
+		assertEquals(0, resampler.getAvailableFrames());
+
+		resampler.dispose();
+	}
+
+	@Test
+	void resampleFloatPassThrough() {
+		StreamingAudioResampler resampler = new StreamingAudioResampler(48000, 48000, 2);
+
+		FloatBuffer src = ByteBuffer.allocateDirect(1000 * 2 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer dst = ByteBuffer.allocateDirect(1000 * 2 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+		for (int i = 0; i < src.capacity(); i++) {
+			src.put(i, i / (float) src.capacity());
+		}
+
+		// Full 10 ms blocks are passed through, the rest is kept as input.
+		assertEquals(960, resampler.resample(src, dst));
+		assertEquals(960 * 2, dst.position());
+
+		for (int i = 0; i < 960 * 2; i++) {
+			assertEquals(src.get(i), dst.get(i));
+		}
+
+		resampler.dispose();
+	}
+
+	@Test
+	void invalidBuffers() {
+		StreamingAudioResampler resampler = new StreamingAudioResampler(44100, 48000, 2);
+
+		ByteBuffer direct = ByteBuffer.allocateDirect(1024 * 2 * 2).order(ByteOrder.nativeOrder());
+		ByteBuffer partial = direct.duplicate();
+		partial.limit(3);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			resampler.resample(ByteBuffer.allocate(1024 * 2 * 2), direct);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			resampler.resample(partial, direct);
+		});
+
+		ByteOrder foreignOrder = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN
+				? ByteOrder.BIG_ENDIAN
+				: ByteOrder.LITTLE_ENDIAN;
+
+		FloatBuffer nativeFloats = ByteBuffer.allocateDirect(1024 * 2 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+		FloatBuffer foreignFloats = ByteBuffer.allocateDirect(1024 * 2 * 4).order(foreignOrder).asFloatBuffer();
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			resampler.resample(foreignFloats, nativeFloats);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			resampler.resample(nativeFloats, foreignFloats);
+		});
+
+		resampler.dispose();
+	}
+
+}
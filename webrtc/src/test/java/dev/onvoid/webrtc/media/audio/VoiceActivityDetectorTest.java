@@ -22,6 +22,9 @@ import org.junit.jupiter.api.AfterEach;
 import org.junit.jupiter.api.BeforeEach;
 import org.junit.jupiter.api.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 public class VoiceActivityDetectorTest {
 
 	private VoiceActivityDetector detector;
@@ -60,6 +63,32 @@ public class VoiceActivityDetectorTest {
 				"Probability should be between 0.0 and 1.0");
 	}
 
+	@Test
+	void testSegmentSilence() {
+		// One second of silence at 16kHz.
+		ByteBuffer pcm = ByteBuffer.allocateDirect(16000 * 2).order(ByteOrder.nativeOrder());
+
+		long[] segments = VoiceActivityDetector.segment(pcm, 16000, new VoiceSegmentationParams());
+
+		assertEquals(0, segments.length, "Silence should not contain speech");
+		assertEquals(0, pcm.position());
+	}
+
+	@Test
+	void testSegmentInvalidArguments() {
+		VoiceSegmentationParams params = new VoiceSegmentationParams();
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			VoiceActivityDetector.segment(ByteBuffer.allocate(320), 16000, params);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			VoiceActivityDetector.segment(ByteBuffer.allocateDirect(320), 22050, params);
+		});
+		assertThrows(IllegalArgumentException.class, () -> {
+			new VoiceSegmentationParams(1.5f, 250, 300);
+		});
+	}
+
 	@Test
 	void testDispose() {
 		// The First operation should work.
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 Alex Andres
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package dev.onvoid.webrtc.media.audio;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+import org.junit.jupiter.api.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+
+class VoiceActivitySegmenterTest {
+
+	@Test
+	void processSilenceInChunks() {
+		AtomicInteger events = new AtomicInteger();
+
+		VoiceActivitySegmenter segmenter = new VoiceActivitySegmenter(48000,
+				new VoiceSegmentationParams(), new VoiceSegmentListener() {
+
+			@Override
+			public void onSpeechStart(long startOffset) {
+				events.incrementAndGet();
+			}
+
+			@Override
+			public void onSpeechEnd(long startOffset, long endOffset) {
+				events.incrementAndGet();
+			}
+		});
+
+		// Chunks that are not a multiple of 10 ms.
+		ByteBuffer chunk = ByteBuffer.allocateDirect(1024 * 2).order(ByteOrder.nativeOrder());
+
+		for (int i = 0; i < 100; i++) {
+			segmenter.process(chunk);
+
+			assertEquals(0, chunk.position());
+		}
+
+		segmenter.flush();
+
+		assertEquals(0, events.get(), "Silence should not contain speech");
+
+		segmenter.dispose();
+	}
+
+	@Test
+	void segmentProbabilities() {
+		List<long[]> starts = new ArrayList<>();
+		List<long[]> ends = new ArrayList<>();
+
+		// 16 kHz: 160 samples per frame, 5 frames minimum speech and a
+		// hangover of 3 frames.
+		VoiceActivitySegmenter segmenter = new VoiceActivitySegmenter(16000,
+				new VoiceSegmentationParams(0.5f, 50, 30), new VoiceSegmentListener() {
+
+			@Override
+			public void onSpeechStart(long startOffset) {
+				starts.add(new long[] { startOffset });
+			}
+
+			@Override
+			public void onSpeechEnd(long startOffset, long endOffset) {
+				ends.add(new long[] { startOffset, endOffset });
+			}
+		});
+
+		segmenter.processProbabilities(new float[] {
+				// Frames 0 - 1: silence.
+				0.0f, 0.0f,
+				// Frames 2 - 3: speech shorter than the minimum is discarded.
+				0.9f, 0.9f, 0.0f, 0.0f, 0.0f, 0.0f,
+				// Frames 8 - 13: speech, confirmed with the fifth frame.
+				0.9f, 0.9f, 0.9f, 0.9f, 0.5f, 0.9f,
+				// Frames 14 - 15: a pause shorter than the hangover.
+				0.1f, 0.1f,
+				// Frames 16 - 17: speech, then the hangover ends the segment.
+				0.9f, 0.9f, 0.0f, 0.0f
+		});
+
+		assertEquals(1, starts.size());
+		assertEquals(1280, starts.get(0)[0]);
+		assertTrue(ends.isEmpty(), "Segment ended within the hangover");
+
+		segmenter.processProbabilities(new float[] {
+				// Frame 20: the hangover ends the segment.
+				0.0f,
+				// Frames 21 - 27: speech that is still open at the end.
+				0.9f, 0.9f, 0.9f, 0.9f, 0.9f, 0.9f, 0.9f
+		});
+
+		assertEquals(2, starts.size());
+		assertEquals(3360, starts.get(1)[0]);
+		assertEquals(1, ends.size());
+		assertArrayEquals(new long[] { 1280, 2880 }, ends.get(0));
+
+		segmenter.flush();
+
+		assertEquals(2, ends.size());
+		assertArrayEquals(new long[] { 3360, 4480 }, ends.get(1));
+
+		// Flushing again does not repeat the segment.
+		segmenter.flush();
+
+		assertEquals(2, ends.size());
+
+		segmenter.dispose();
+	}
+
+	@Test
+	void invalidArguments() {
+		VoiceSegmentationParams params = new VoiceSegmentationParams();
+		VoiceSegmentListener listener = new VoiceSegmentListener() {
+
+			@Override
+			public void onSpeechStart(long startOffset) {
+			}
+
+			@Override
+			public void onSpeechEnd(long startOffset, long endOffset) {
+			}
+		};
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			new VoiceActivitySegmenter(44000 + 50, params, listener);
+		});
+		assertThrows(NullPointerException.class, () -> {
+			new VoiceActivitySegmenter(16000, params, null);
+		});
+
+		VoiceActivitySegmenter segmenter = new VoiceActivitySegmenter(16000, params, listener);
+
+		assertThrows(IllegalArgumentException.class, () -> {
+			segmenter.process(ByteBuffer.allocate(320));
+		});
+
+		segmenter.dispose();
+	}
+
+}